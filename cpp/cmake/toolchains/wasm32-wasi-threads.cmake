@@ -0,0 +1,5 @@
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_VERSION 1)
+set(CMAKE_SYSTEM_PROCESSOR wasm32)
+set(CMAKE_C_COMPILER_TARGET wasm32-wasi-threads)
+set(CMAKE_CXX_COMPILER_TARGET wasm32-wasi-threads)
@@ -0,0 +1,386 @@
+#include "barretenberg/crypto/ecdsa/ecdsa.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/honk/composer/standard_honk_composer.hpp"
+#include "barretenberg/honk/composer/ultra_honk_composer.hpp"
+#include "barretenberg/honk/proof_system/prover.hpp"
+#include "barretenberg/honk/proof_system/ultra_prover.hpp"
+#include "barretenberg/plonk/composer/standard_composer.hpp"
+#include "barretenberg/plonk/composer/turbo_composer.hpp"
+#include "barretenberg/plonk/composer/ultra_composer.hpp"
+#include "barretenberg/plonk/proof_system/prover/prover.hpp"
+#include "barretenberg/stdlib/encryption/ecdsa/ecdsa.hpp"
+#include "barretenberg/stdlib/hash/keccak/keccak.hpp"
+#include "barretenberg/stdlib/hash/sha256/sha256.hpp"
+#include "barretenberg/stdlib/primitives/curves/bn254.hpp"
+#include "barretenberg/stdlib/primitives/curves/secp256k1.hpp"
+#include "barretenberg/stdlib/recursion/verifier/program_settings.hpp"
+#include "barretenberg/stdlib/recursion/verifier/verifier.hpp"
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#ifndef __wasm__
+#include <sys/resource.h>
+#endif
+
+/**
+ * End-to-end proving benchmarks: every proving system against a set of representative circuits, from 2^12 to 2^22
+ * gates. The benchmark time is the prover time; the counters break it down by prover round and add the proving key
+ * construction time, the verifier time, the peak RSS and the proof size.
+ *
+ * For regression tracking, run with --benchmark_format=json (or --benchmark_out=<file>) and diff two runs with
+ * benchmark's tools/compare.py, as in honk_bench/compare_honk_bench.sh. Use --benchmark_filter to pick a system,
+ * circuit or size, e.g. --benchmark_filter='UltraPlonk, Sha256>/1[2-6]/'.
+ *
+ * The stdlib only supports the Plonk composers, so the Honk flavors only get the arithmetic circuit. Keccak, ECDSA and
+ * recursion need lookups and only run on UltraPlonk. A circuit that can't fit a single instance of its gadget in the
+ * requested size is skipped.
+ */
+
+using namespace benchmark;
+using namespace proof_system;
+
+namespace {
+
+constexpr size_t MIN_LOG_NUM_GATES = 12;
+constexpr size_t MAX_LOG_NUM_GATES = 22;
+const std::string CRS_PATH = "../srs_db/ignition";
+
+// Rows added to a circuit after construction (reserved gates, public inputs, padding), left free so that filling a
+// circuit doesn't push it into the next power of two
+constexpr size_t NUM_SLACK_ROWS = 64;
+
+/**
+ * @brief Resets the peak resident set size of the process, so it can be measured for each benchmark
+ *
+ * @details Only Linux supports this; elsewhere the reported peak is over the process so far (and under wasm there is
+ * none).
+ */
+void reset_peak_rss()
+{
+    std::ofstream("/proc/self/clear_refs") << "5";
+}
+
+/**
+ * @brief The peak resident set size of the process in MiB, since the last reset_peak_rss()
+ */
+double get_peak_rss_mb()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with("VmHWM:")) {
+            return std::stod(line.substr(6)) / 1024;
+        }
+    }
+#ifndef __wasm__
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_maxrss) / 1024;
+#else
+    return 0;
+#endif
+}
+
+double get_elapsed_ms(const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Accumulates the time spent in each prover round over all the proofs of a benchmark
+ *
+ * @details Passed to the provers' construct_proof() as its round callback, so each round is timed up to the callback
+ * that ends it.
+ */
+class RoundTimer {
+  public:
+    void start_proof()
+    {
+        round_index = 0;
+        proof_ms = 0;
+        round_start = std::chrono::steady_clock::now();
+    }
+
+    void round_completed(std::string_view round)
+    {
+        const double ms = get_elapsed_ms(round_start);
+        // Numbered so that the rounds are listed in order
+        if (round_index == round_ms.size()) {
+            round_ms.emplace_back("round_" + std::to_string(round_index) + "_" + std::string(round), 0);
+        }
+        round_ms[round_index++].second += ms;
+        proof_ms += ms;
+        round_start = std::chrono::steady_clock::now();
+    }
+
+    double get_proof_seconds() const { return proof_ms / 1000; }
+
+    void add_counters(State& state) const
+    {
+        for (const auto& [name, ms] : round_ms) {
+            state.counters[name + "_ms"] = Counter(ms, Counter::kAvgIterations);
+        }
+    }
+
+  private:
+    std::vector<std::pair<std::string, double>> round_ms;
+    size_t round_index = 0;
+    double proof_ms = 0;
+    std::chrono::steady_clock::time_point round_start;
+};
+
+// Proving systems
+
+struct StandardPlonk {
+    using Composer = plonk::StandardComposer;
+};
+struct TurboPlonk {
+    using Composer = plonk::TurboComposer;
+};
+struct UltraPlonk {
+    using Composer = plonk::UltraComposer;
+};
+struct StandardHonk {
+    using Composer = honk::StandardHonkComposer;
+};
+struct UltraHonk {
+    using Composer = honk::UltraHonkComposer;
+};
+
+// The Honk composers don't implement the full composer interface yet, but their circuit constructors do
+template <typename Composer> auto& get_circuit_builder(Composer& composer)
+{
+    if constexpr (requires { composer.circuit_constructor; }) {
+        return composer.circuit_constructor;
+    } else {
+        return composer;
+    }
+}
+
+/**
+ * @brief Adds instances of a gadget to a circuit for as long as another one fits in 2^log_num_gates rows
+ *
+ * @return false if not even one instance fits
+ */
+template <typename Composer> bool fill_circuit(Composer& composer, size_t log_num_gates, const auto& add_instance)
+{
+    const size_t max_circuit_size = (1UL << log_num_gates) - NUM_SLACK_ROWS;
+    // The first instance also pays for e.g. lookup tables, so later ones are sized by the smallest increment seen
+    size_t instance_size = max_circuit_size;
+    do {
+        const size_t circuit_size = composer.get_total_circuit_size();
+        add_instance();
+        instance_size = std::min(instance_size, composer.get_total_circuit_size() - circuit_size);
+    } while (composer.get_total_circuit_size() + instance_size <= max_circuit_size);
+    return composer.get_total_circuit_size() <= max_circuit_size;
+}
+
+// Circuits. build() returns false if the circuit can't be built at the requested size.
+
+/**
+ * @brief A chain of c = a * b + a + b gates, one gate each
+ */
+struct Arithmetic {
+    template <typename Composer> static bool build(Composer& composer, size_t log_num_gates)
+    {
+        auto& builder = get_circuit_builder(composer);
+        const barretenberg::fr one = barretenberg::fr::one();
+        barretenberg::fr a_value = barretenberg::fr::random_element();
+        barretenberg::fr b_value = barretenberg::fr::random_element();
+        uint32_t a = builder.add_variable(a_value);
+        uint32_t b = builder.add_variable(b_value);
+        const size_t num_gates = (1UL << log_num_gates) - NUM_SLACK_ROWS;
+        while (builder.get_num_gates() < num_gates) {
+            const barretenberg::fr c_value = a_value * b_value + a_value + b_value;
+            const uint32_t c = builder.add_variable(c_value);
+            builder.create_poly_gate({ a, b, c, one, one, one, -one, barretenberg::fr::zero() });
+            a_value = b_value;
+            b_value = c_value;
+            a = b;
+            b = c;
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief SHA256 of 64-byte messages, two compression rounds each
+ */
+struct Sha256 {
+    template <typename Composer> static bool build(Composer& composer, size_t log_num_gates)
+    {
+        return fill_circuit(composer, log_num_gates, [&] {
+            const std::string message(64, static_cast<char>(barretenberg::fr::random_element().data[0] & 0xff));
+            plonk::stdlib::packed_byte_array<Composer> input(&composer, message);
+            plonk::stdlib::sha256<Composer>(input);
+        });
+    }
+};
+
+/**
+ * @brief Keccak256 of 136-byte (one rate-sized block) messages
+ */
+struct Keccak {
+    template <typename Composer> static bool build(Composer& composer, size_t log_num_gates)
+    {
+        return fill_circuit(composer, log_num_gates, [&] {
+            std::vector<uint8_t> message(136);
+            for (auto& byte : message) {
+                byte = static_cast<uint8_t>(barretenberg::fr::random_element().data[0]);
+            }
+            plonk::stdlib::byte_array<Composer> input(&composer, message);
+            plonk::stdlib::keccak<Composer>::hash(input);
+        });
+    }
+};
+
+/**
+ * @brief secp256k1 ECDSA signature verifications
+ */
+struct Ecdsa {
+    template <typename Composer> static bool build(Composer& composer, size_t log_num_gates)
+    {
+        using curve = plonk::stdlib::secp256k1<Composer>;
+        const std::string message_string = "Instructions unclear, ask again later.";
+        crypto::ecdsa::key_pair<typename curve::fr, typename curve::g1> account;
+        account.private_key = curve::fr::random_element();
+        account.public_key = curve::g1::one * account.private_key;
+        const crypto::ecdsa::signature signature =
+            crypto::ecdsa::construct_signature<Sha256Hasher, typename curve::fq, typename curve::fr, typename curve::g1>(
+                message_string, account);
+
+        return fill_circuit(composer, log_num_gates, [&] {
+            auto public_key = curve::g1_bigfr_ct::from_witness(&composer, account.public_key);
+            std::vector<uint8_t> r(signature.r.begin(), signature.r.end());
+            std::vector<uint8_t> s(signature.s.begin(), signature.s.end());
+            plonk::stdlib::ecdsa::signature<Composer> sig{ typename curve::byte_array_ct(&composer, r),
+                                                           typename curve::byte_array_ct(&composer, s),
+                                                           plonk::stdlib::uint8<Composer>(&composer, signature.v) };
+            typename curve::byte_array_ct message(&composer, message_string);
+            plonk::stdlib::ecdsa::verify_signature<Composer,
+                                                   curve,
+                                                   typename curve::fq_ct,
+                                                   typename curve::bigfr_ct,
+                                                   typename curve::g1_bigfr_ct>(message, public_key, sig);
+        });
+    }
+};
+
+/**
+ * @brief Verifications of an UltraPlonk proof. The inner proof is constructed once and shared by all benchmarks.
+ */
+struct Recursion {
+    template <typename Composer> static bool build(Composer& composer, size_t log_num_gates)
+    {
+        static_assert(std::is_same_v<Composer, plonk::UltraComposer>);
+        using curve = plonk::stdlib::bn254<Composer>;
+        using verification_key_pt = plonk::stdlib::recursion::verification_key<curve>;
+        using recursive_settings = plonk::stdlib::recursion::recursive_ultra_verifier_settings<curve>;
+
+        struct InnerProof {
+            std::shared_ptr<plonk::verification_key> verification_key;
+            transcript::Manifest manifest;
+            plonk::proof proof;
+        };
+        static const InnerProof inner = [] {
+            Composer inner_composer(CRS_PATH);
+            typename curve::fr_ct a(typename curve::public_witness_ct(&inner_composer, barretenberg::fr::random_element()));
+            typename curve::fr_ct b(typename curve::witness_ct(&inner_composer, barretenberg::fr::random_element()));
+            for (size_t i = 0; i < 32; ++i) {
+                a = a.madd(b, a);
+            }
+            auto prover = inner_composer.create_prover();
+            auto verification_key = inner_composer.compute_verification_key();
+            auto manifest = Composer::create_manifest(prover.key->num_public_inputs);
+            return InnerProof{ verification_key, manifest, prover.construct_proof() };
+        }();
+
+        return fill_circuit(composer, log_num_gates, [&] {
+            auto verification_key = verification_key_pt::from_witness(&composer, inner.verification_key);
+            plonk::stdlib::recursion::verify_proof<curve, recursive_settings>(
+                &composer, verification_key, inner.manifest, inner.proof);
+        });
+    }
+};
+
+/**
+ * @brief Benchmark: Construction of a proof of a Circuit of 2^range(0) gates with a System
+ */
+template <typename System, typename Circuit> void construct_proof_bench(State& state) noexcept
+{
+    using Composer = typename System::Composer;
+    const auto log_num_gates = static_cast<size_t>(state.range(0));
+
+    reset_peak_rss();
+    RoundTimer timer;
+    double proving_key_ms = 0;
+    double verifier_ms = 0;
+    size_t num_gates = 0;
+    size_t circuit_size = 0;
+    size_t proof_size = 0;
+    for (auto _ : state) {
+        Composer composer(CRS_PATH, 1UL << log_num_gates);
+        if (!Circuit::build(composer, log_num_gates)) {
+            state.SkipWithError("circuit doesn't fit in the requested size");
+            break;
+        }
+        num_gates = get_circuit_builder(composer).get_num_gates();
+
+        auto start = std::chrono::steady_clock::now();
+        auto prover = composer.create_prover();
+        proving_key_ms += get_elapsed_ms(start);
+
+        timer.start_proof();
+        const plonk::proof& proof =
+            prover.construct_proof([&](std::string_view round) { timer.round_completed(round); });
+        state.SetIterationTime(timer.get_proof_seconds());
+
+        auto verifier = composer.create_verifier();
+        start = std::chrono::steady_clock::now();
+        const bool verified = verifier.verify_proof(proof);
+        verifier_ms += get_elapsed_ms(start);
+        if (!verified) {
+            state.SkipWithError("proof failed to verify");
+            break;
+        }
+
+        circuit_size = prover.key->circuit_size;
+        proof_size = proof.proof_data.size();
+    }
+
+    timer.add_counters(state);
+    state.counters["proving_key_ms"] = Counter(proving_key_ms, Counter::kAvgIterations);
+    state.counters["verifier_ms"] = Counter(verifier_ms, Counter::kAvgIterations);
+    state.counters["peak_rss_mb"] = get_peak_rss_mb();
+    state.counters["gates"] = static_cast<double>(num_gates);
+    state.counters["circuit_size"] = static_cast<double>(circuit_size);
+    state.counters["proof_bytes"] = static_cast<double>(proof_size);
+}
+
+#define PROVING_BENCHMARK(System, Circuit)                                                                             \
+    BENCHMARK_TEMPLATE(construct_proof_bench, System, Circuit)                                                         \
+        ->DenseRange(MIN_LOG_NUM_GATES, MAX_LOG_NUM_GATES, 1)                                                          \
+        ->UseManualTime()                                                                                              \
+        ->Unit(kMillisecond)
+
+PROVING_BENCHMARK(StandardPlonk, Arithmetic);
+PROVING_BENCHMARK(TurboPlonk, Arithmetic);
+PROVING_BENCHMARK(UltraPlonk, Arithmetic);
+PROVING_BENCHMARK(StandardHonk, Arithmetic);
+PROVING_BENCHMARK(UltraHonk, Arithmetic);
+
+PROVING_BENCHMARK(StandardPlonk, Sha256);
+PROVING_BENCHMARK(TurboPlonk, Sha256);
+PROVING_BENCHMARK(UltraPlonk, Sha256);
+
+PROVING_BENCHMARK(UltraPlonk, Keccak);
+PROVING_BENCHMARK(UltraPlonk, Ecdsa);
+PROVING_BENCHMARK(UltraPlonk, Recursion);
+
+} // namespace
+
+BENCHMARK_MAIN();
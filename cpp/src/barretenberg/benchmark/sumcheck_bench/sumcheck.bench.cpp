@@ -0,0 +1,304 @@
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/honk/composer/ultra_honk_composer.hpp"
+#include "barretenberg/honk/flavor/ultra.hpp"
+#include "barretenberg/honk/proof_system/ultra_prover.hpp"
+#include "barretenberg/honk/sumcheck/sumcheck.hpp"
+#include "barretenberg/honk/sumcheck/sumcheck_round.hpp"
+#include "barretenberg/honk/transcript/transcript.hpp"
+#include "barretenberg/proof_system/plookup_tables/plookup_tables.hpp"
+
+#include <benchmark/benchmark.h>
+#include <memory>
+
+/**
+ * Micro-benchmarks of the Ultra Honk sumcheck prover: each relation's add_edge_contribution, and the phases of a round
+ * (extend_edges, compute_univariate, partially_evaluate), as well as a full sumcheck.
+ *
+ * Every benchmark runs on two inputs: random polynomials, and the polynomials of a real circuit (a mix of arithmetic,
+ * lookup, range, elliptic curve and ROM gates) as the Ultra prover has them when it starts sumcheck. The field
+ * arithmetic costs the same on both, but the real circuit has the selector sparsity and the value distribution that
+ * e.g. zero-skipping optimisations would depend on.
+ */
+
+using namespace benchmark;
+using namespace proof_system::honk;
+using namespace proof_system::honk::sumcheck;
+
+namespace {
+
+using Flavor = flavor::Ultra;
+using FF = typename Flavor::FF;
+using Polynomial = typename Flavor::Polynomial;
+using ProverPolynomials = typename Flavor::ProverPolynomials;
+using ExtendedEdges = typename Flavor::template ExtendedEdges<Flavor::MAX_RELATION_LENGTH>;
+
+constexpr size_t MIN_LOG_ROUND_SIZE = 10;
+constexpr size_t MAX_LOG_ROUND_SIZE = 16;
+constexpr size_t MAX_ROUND_SIZE = 1UL << MAX_LOG_ROUND_SIZE;
+
+// Edges sampled (evenly over the input) to feed the relation benchmarks
+constexpr size_t NUM_SAMPLED_EDGES = 64;
+
+/**
+ * @brief Random values for every polynomial and relation parameter
+ */
+struct RandomInput {
+    std::array<Polynomial, Flavor::NUM_ALL_ENTITIES> storage;
+    ProverPolynomials polynomials;
+    RelationParameters<FF> relation_parameters;
+    size_t size = MAX_ROUND_SIZE;
+
+    RandomInput()
+    {
+        size_t poly_idx = 0; // TODO(#391) zip
+        for (auto& polynomial : polynomials) {
+            storage[poly_idx] = Polynomial(size);
+            for (auto& coefficient : storage[poly_idx]) {
+                coefficient = FF::random_element();
+            }
+            polynomial = storage[poly_idx];
+            ++poly_idx;
+        }
+        relation_parameters = RelationParameters<FF>{ .eta = FF::random_element(),
+                                                      .beta = FF::random_element(),
+                                                      .gamma = FF::random_element(),
+                                                      .public_input_delta = FF::random_element(),
+                                                      .lookup_grand_product_delta = FF::random_element() };
+    }
+
+    static RandomInput& get()
+    {
+        static RandomInput input;
+        return input;
+    }
+};
+
+/**
+ * @brief The polynomials and relation parameters of a real Ultra circuit of MAX_ROUND_SIZE rows, as the prover passes
+ * them to sumcheck
+ */
+struct CircuitInput {
+    UltraHonkComposer composer;
+    UltraProver prover;
+    ProverPolynomials& polynomials;
+    RelationParameters<FF>& relation_parameters;
+    size_t size;
+
+    CircuitInput()
+        : composer("../srs_db/ignition", MAX_ROUND_SIZE)
+        , prover(build_circuit(composer).create_prover())
+        , polynomials(prover.prover_polynomials)
+        , relation_parameters(prover.relation_parameters)
+        , size(prover.key->circuit_size)
+    {
+        // The rounds before sumcheck, which compute the grand products and the relation parameters
+        prover.execute_preamble_round();
+        prover.execute_wire_commitments_round();
+        prover.queue.process_queue();
+        prover.execute_sorted_list_accumulator_round();
+        prover.queue.process_queue();
+        prover.execute_grand_product_computation_round();
+        prover.queue.process_queue();
+    }
+
+    static CircuitInput& get()
+    {
+        static CircuitInput input;
+        return input;
+    }
+
+    /**
+     * @brief Fills half the rows with blocks of arithmetic, lookup, range, elliptic curve and ROM gates. The lookup
+     * tables and the gates added on finalisation take up part of the rest.
+     */
+    static UltraHonkComposer& build_circuit(UltraHonkComposer& composer)
+    {
+        using affine_element = grumpkin::g1::affine_element;
+        using element = grumpkin::g1::element;
+        auto& circuit_constructor = composer.circuit_constructor;
+
+        constexpr size_t ROM_SIZE = 16;
+        const size_t rom_id = composer.create_ROM_array(ROM_SIZE);
+        for (size_t i = 0; i < ROM_SIZE; ++i) {
+            composer.set_ROM_element(rom_id, i, composer.add_variable(FF::random_element()));
+        }
+
+        const affine_element p1(element::random_element());
+        const affine_element p2(element::random_element());
+        const affine_element p3(element(p1) + element(p2));
+        const std::array<uint32_t, 6> ecc_witnesses{ composer.add_variable(p1.x), composer.add_variable(p1.y),
+                                                     composer.add_variable(p2.x), composer.add_variable(p2.y),
+                                                     composer.add_variable(p3.x), composer.add_variable(p3.y) };
+
+        FF a_value = FF::random_element();
+        FF b_value = FF::random_element();
+        uint32_t a = composer.add_variable(a_value);
+        uint32_t b = composer.add_variable(b_value);
+        while (circuit_constructor.num_gates < MAX_ROUND_SIZE / 2) {
+            for (size_t i = 0; i < 8; ++i) {
+                const FF c_value = a_value * b_value + a_value + b_value;
+                const uint32_t c = composer.add_variable(c_value);
+                circuit_constructor.create_poly_gate({ a, b, c, 1, 1, 1, -1, 0 });
+                a_value = b_value;
+                b_value = c_value;
+                a = b;
+                b = c;
+            }
+
+            const auto left = static_cast<uint32_t>(a_value.from_montgomery_form().data[0]);
+            const auto right = static_cast<uint32_t>(b_value.from_montgomery_form().data[0]);
+            const auto accumulators =
+                plookup::get_lookup_accumulators(plookup::MultiTableId::UINT32_XOR, FF(left), FF(right), true);
+            composer.create_gates_from_plookup_accumulators(plookup::MultiTableId::UINT32_XOR,
+                                                            accumulators,
+                                                            composer.add_variable(FF(left)),
+                                                            composer.add_variable(FF(right)));
+
+            composer.create_new_range_constraint(composer.add_variable(FF(left & 0xff)), 0xff);
+
+            composer.create_ecc_add_gate({ ecc_witnesses[0],
+                                           ecc_witnesses[1],
+                                           ecc_witnesses[2],
+                                           ecc_witnesses[3],
+                                           ecc_witnesses[4],
+                                           ecc_witnesses[5],
+                                           1,
+                                           1 });
+
+            composer.read_ROM_array(rom_id, composer.add_variable(FF(right % ROM_SIZE)));
+        }
+        return composer;
+    }
+};
+
+/**
+ * @brief Extended edges of NUM_SAMPLED_EDGES edges spread over the input
+ */
+template <typename Input> std::vector<ExtendedEdges> sample_extended_edges(Input& input)
+{
+    SumcheckRound<Flavor> round(input.size);
+    std::vector<ExtendedEdges> edges;
+    for (size_t i = 0; i < NUM_SAMPLED_EDGES; ++i) {
+        round.extend_edges(input.polynomials, 2 * ((i * input.size / 2) / NUM_SAMPLED_EDGES));
+        edges.push_back(round.extended_edges);
+    }
+    return edges;
+}
+
+/**
+ * @brief Benchmark: Relation::add_edge_contribution on one edge
+ */
+template <typename Relation, typename Input> void add_edge_contribution_bench(State& state) noexcept
+{
+    auto& input = Input::get();
+    const auto edges = sample_extended_edges(input);
+    const Relation relation;
+    typename Relation::RelationUnivariates accumulator{};
+    const FF scaling_factor = FF::random_element();
+    size_t edge_idx = 0;
+    for (auto _ : state) {
+        relation.add_edge_contribution(accumulator, edges[edge_idx], input.relation_parameters, scaling_factor);
+        edge_idx = (edge_idx + 1) % NUM_SAMPLED_EDGES;
+    }
+    DoNotOptimize(accumulator);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+#define RELATION_BENCHMARK(Relation)                                                                                   \
+    BENCHMARK_TEMPLATE(add_edge_contribution_bench, Relation<FF>, RandomInput);                                        \
+    BENCHMARK_TEMPLATE(add_edge_contribution_bench, Relation<FF>, CircuitInput)
+
+RELATION_BENCHMARK(UltraArithmeticRelation);
+RELATION_BENCHMARK(UltraPermutationRelation);
+RELATION_BENCHMARK(LookupRelation);
+RELATION_BENCHMARK(GenPermSortRelation);
+RELATION_BENCHMARK(EllipticRelation);
+RELATION_BENCHMARK(AuxiliaryRelation);
+
+/**
+ * @brief Benchmark: SumcheckRound::extend_edges over every edge of a round of size 2^range(0)
+ */
+template <typename Input> void extend_edges_bench(State& state) noexcept
+{
+    auto& input = Input::get();
+    const size_t round_size = 1UL << static_cast<size_t>(state.range(0));
+    SumcheckRound<Flavor> round(round_size);
+    for (auto _ : state) {
+        for (size_t edge_idx = 0; edge_idx < round_size; edge_idx += 2) {
+            round.extend_edges(input.polynomials, edge_idx);
+            DoNotOptimize(round.extended_edges);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(round_size / 2));
+}
+BENCHMARK_TEMPLATE(extend_edges_bench, RandomInput)->DenseRange(MIN_LOG_ROUND_SIZE, MAX_LOG_ROUND_SIZE, 2);
+BENCHMARK_TEMPLATE(extend_edges_bench, CircuitInput)->DenseRange(MIN_LOG_ROUND_SIZE, MAX_LOG_ROUND_SIZE, 2);
+
+/**
+ * @brief Benchmark: SumcheckRound::compute_univariate for a round of size 2^range(0)
+ */
+template <typename Input> void compute_univariate_bench(State& state) noexcept
+{
+    auto& input = Input::get();
+    const size_t round_size = 1UL << static_cast<size_t>(state.range(0));
+    SumcheckRound<Flavor> round(round_size);
+    PowUnivariate<FF> pow_univariate(FF::random_element());
+    const FF alpha = FF::random_element();
+    for (auto _ : state) {
+        DoNotOptimize(round.compute_univariate(input.polynomials, input.relation_parameters, pow_univariate, alpha));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(round_size / 2));
+}
+BENCHMARK_TEMPLATE(compute_univariate_bench, RandomInput)
+    ->DenseRange(MIN_LOG_ROUND_SIZE, MAX_LOG_ROUND_SIZE, 2)
+    ->Unit(kMillisecond);
+BENCHMARK_TEMPLATE(compute_univariate_bench, CircuitInput)
+    ->DenseRange(MIN_LOG_ROUND_SIZE, MAX_LOG_ROUND_SIZE, 2)
+    ->Unit(kMillisecond);
+
+/**
+ * @brief Benchmark: Sumcheck::partially_evaluate of the full polynomials, for a round of size 2^range(0)
+ */
+template <typename Input> void partially_evaluate_bench(State& state) noexcept
+{
+    auto& input = Input::get();
+    const size_t round_size = 1UL << static_cast<size_t>(state.range(0));
+    auto transcript = ProverTranscript<FF>::init_empty();
+    Sumcheck<Flavor, ProverTranscript<FF>> sumcheck(round_size, transcript);
+    const FF round_challenge = FF::random_element();
+    for (auto _ : state) {
+        sumcheck.partially_evaluate(input.polynomials, round_size, round_challenge);
+        DoNotOptimize(sumcheck.partially_evaluated_polynomials);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(round_size / 2));
+}
+BENCHMARK_TEMPLATE(partially_evaluate_bench, RandomInput)->DenseRange(MIN_LOG_ROUND_SIZE, MAX_LOG_ROUND_SIZE, 2);
+BENCHMARK_TEMPLATE(partially_evaluate_bench, CircuitInput)->DenseRange(MIN_LOG_ROUND_SIZE, MAX_LOG_ROUND_SIZE, 2);
+
+/**
+ * @brief Benchmark: Every round of the sumcheck prover, for polynomials of size 2^range(0)
+ */
+template <typename Input> void sumcheck_prover_bench(State& state) noexcept
+{
+    auto& input = Input::get();
+    const size_t multivariate_n = 1UL << static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto transcript = ProverTranscript<FF>::init_empty();
+        Sumcheck<Flavor, ProverTranscript<FF>> sumcheck(multivariate_n, transcript);
+        state.ResumeTiming();
+
+        DoNotOptimize(sumcheck.execute_prover(input.polynomials, input.relation_parameters));
+    }
+}
+BENCHMARK_TEMPLATE(sumcheck_prover_bench, RandomInput)
+    ->DenseRange(MIN_LOG_ROUND_SIZE, MAX_LOG_ROUND_SIZE, 2)
+    ->Unit(kMillisecond);
+BENCHMARK_TEMPLATE(sumcheck_prover_bench, CircuitInput)
+    ->DenseRange(MIN_LOG_ROUND_SIZE, MAX_LOG_ROUND_SIZE, 2)
+    ->Unit(kMillisecond);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -1,28 +1,17 @@
 #pragma once
 
-// #include <omp.h>
-#ifndef NO_MULTITHREADING
-#include <omp.h>
-#endif
-#include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/common/thread.hpp"
 
 namespace max_threads {
 //
 // This method will compute the number of threads which would be used
 // for computation in barretenberg. We set it to the max number of threads
-// possible for a system (using the openmp package). However, if any system
-// has max number of threads which is NOT a power of two, we set number of threads
-// to be used as the previous power of two.
+// possible for a system (using the openmp package, or the worker pool in the
+// wasm threads build). However, if any system has max number of threads which
+// is NOT a power of two, we set number of threads to be used as the previous
+// power of two.
 inline size_t compute_num_threads()
 {
-#ifndef NO_MULTITHREADING
-    size_t num_threads = static_cast<size_t>(omp_get_max_threads());
-#else
-    size_t num_threads = 1;
-#endif
-
-    // ensure that num_threads is a power of two
-    num_threads = static_cast<size_t>(1ULL << numeric::get_msb(num_threads));
-    return num_threads;
+    return barretenberg::get_num_cpus_pow2();
 }
 } // namespace max_threads
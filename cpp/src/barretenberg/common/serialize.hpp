@@ -400,10 +400,11 @@ template <typename T> std::vector<uint8_t> to_buffer(T const& value)
     return buf;
 }
 
-template <typename T> std::vector<T> many_from_buffer(std::vector<uint8_t> const& buffer)
+template <typename T, typename B> std::vector<T> many_from_buffer(B const& buffer)
 {
     const size_t num_elements = buffer.size() / sizeof(T);
     std::vector<T> elements;
+    elements.reserve(num_elements);
     for (size_t i = 0; i < num_elements; ++i) {
         elements.push_back(from_buffer<T>(buffer, i * sizeof(T)));
     }
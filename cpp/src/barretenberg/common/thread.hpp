@@ -0,0 +1,223 @@
+#pragma once
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+
+#include <cstddef>
+#include <functional>
+
+#ifndef NO_MULTITHREADING
+#include <omp.h>
+#endif
+
+#ifdef WASM_THREADS
+#include "barretenberg/env/hardware_concurrency.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+/**
+ * Threading backends:
+ *
+ * - Native builds parallelise with OpenMP.
+ * - The wasm32 threads build (`WASM_THREADS`) has no OpenMP runtime. It compiles with `NO_MULTITHREADING`, so the
+ *   remaining `#pragma omp` loops run serially, and `parallel_for` below hands work to a persistent pool of pthreads.
+ *   The JS host backs each pthread with a worker that shares the module's memory.
+ * - All other builds, including the single-threaded wasm module, run everything on the calling thread.
+ *
+ * Code that should scale on every backend uses `parallel_for`. It splits work over `get_num_cpus()` iterations, or
+ * over `get_num_cpus_pow2()` iterations where the split has to be a power of two.
+ */
+namespace barretenberg {
+
+#ifdef WASM_THREADS
+namespace thread_detail {
+
+/**
+ * @brief A fixed set of worker threads that cooperatively execute one parallel_for at a time.
+ *
+ * @details Spawning a thread in wasm means the host starting a worker and instantiating the module in it, which is
+ * far too slow to do per loop, so workers are created once and parked on a condition variable between jobs. The
+ * calling thread takes part in every job. Iterations are handed out through an atomic counter, so uneven iterations
+ * balance themselves.
+ */
+class ThreadPool {
+  public:
+    explicit ThreadPool(size_t num_workers)
+    {
+        workers.reserve(num_workers);
+        for (size_t i = 0; i < num_workers; ++i) {
+            workers.emplace_back([this]() { worker_loop(); });
+        }
+    }
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ~ThreadPool()
+    {
+        {
+            std::unique_lock lock(mutex);
+            stop = true;
+        }
+        job_available.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    void run(size_t num_iterations, const std::function<void(size_t)>& func)
+    {
+        // One job at a time; concurrent callers queue up here
+        std::unique_lock run_lock(run_mutex);
+        {
+            std::unique_lock lock(mutex);
+            job = &func;
+            job_size = num_iterations;
+            next_iteration = 0;
+            iterations_remaining = num_iterations;
+            ++job_generation;
+        }
+        job_available.notify_all();
+
+        in_parallel_region() = true;
+        do_work(func, num_iterations);
+        in_parallel_region() = false;
+
+        // Wait for stragglers as well as for the iterations, so no worker can still be claiming from the counter
+        // when the next job resets it
+        std::unique_lock lock(mutex);
+        job_complete.wait(lock, [this]() { return iterations_remaining == 0 && active_workers == 0; });
+        job = nullptr;
+    }
+
+    static bool& in_parallel_region()
+    {
+        static thread_local bool in_region = false;
+        return in_region;
+    }
+
+  private:
+    void worker_loop()
+    {
+        in_parallel_region() = true;
+        size_t seen_generation = 0;
+        while (true) {
+            const std::function<void(size_t)>* func = nullptr;
+            size_t size = 0;
+            {
+                std::unique_lock lock(mutex);
+                job_available.wait(lock, [&]() { return stop || job_generation != seen_generation; });
+                if (stop) {
+                    return;
+                }
+                seen_generation = job_generation;
+                if (job == nullptr) {
+                    // woke up after the job already finished
+                    continue;
+                }
+                func = job;
+                size = job_size;
+                ++active_workers;
+            }
+            do_work(*func, size);
+            {
+                std::unique_lock lock(mutex);
+                --active_workers;
+            }
+            job_complete.notify_all();
+        }
+    }
+
+    void do_work(const std::function<void(size_t)>& func, size_t size)
+    {
+        size_t completed = 0;
+        for (size_t i = next_iteration.fetch_add(1); i < size; i = next_iteration.fetch_add(1)) {
+            func(i);
+            ++completed;
+        }
+        if (completed > 0) {
+            {
+                std::unique_lock lock(mutex);
+                iterations_remaining -= completed;
+            }
+            job_complete.notify_all();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex run_mutex;
+    std::mutex mutex;
+    std::condition_variable job_available;
+    std::condition_variable job_complete;
+    const std::function<void(size_t)>* job = nullptr;
+    size_t job_size = 0;
+    size_t job_generation = 0;
+    size_t iterations_remaining = 0;
+    size_t active_workers = 0;
+    std::atomic<size_t> next_iteration = 0;
+    bool stop = false;
+};
+
+inline ThreadPool& get_thread_pool()
+{
+    static ThreadPool pool(env_hardware_concurrency() > 1 ? env_hardware_concurrency() - 1 : 0);
+    return pool;
+}
+
+} // namespace thread_detail
+#endif
+
+/**
+ * @brief Number of threads that parallel_for spreads work over.
+ */
+inline size_t get_num_cpus()
+{
+#if !defined(NO_MULTITHREADING)
+    return static_cast<size_t>(omp_get_max_threads());
+#elif defined(WASM_THREADS)
+    const size_t num_cpus = static_cast<size_t>(env_hardware_concurrency());
+    return num_cpus > 0 ? num_cpus : 1;
+#else
+    return 1;
+#endif
+}
+
+/**
+ * @brief get_num_cpus rounded down to a power of two.
+ */
+inline size_t get_num_cpus_pow2()
+{
+    return static_cast<size_t>(1ULL << numeric::get_msb(static_cast<uint64_t>(get_num_cpus())));
+}
+
+/**
+ * @brief Call `func(i)` for every i in [0, num_iterations), spread over the available threads.
+ *
+ * @details Returns once every iteration has completed, i.e. each call acts as a barrier. Nested calls from inside a
+ * parallel region run serially. Natively this is exactly an `omp parallel for` over `func`, which is called directly;
+ * only the wasm pool goes through a std::function. Loops with several dependent rounds (e.g. the FFT) should keep one
+ * `omp parallel` region natively rather than calling this once per round.
+ */
+template <typename Func> inline void parallel_for(size_t num_iterations, const Func& func)
+{
+#if !defined(NO_MULTITHREADING)
+#pragma omp parallel for
+    for (size_t i = 0; i < num_iterations; ++i) {
+        func(i);
+    }
+#elif defined(WASM_THREADS)
+    if (num_iterations <= 1 || thread_detail::ThreadPool::in_parallel_region()) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+        return;
+    }
+    thread_detail::get_thread_pool().run(num_iterations, std::function<void(size_t)>(func));
+#else
+    for (size_t i = 0; i < num_iterations; ++i) {
+        func(i);
+    }
+#endif
+}
+
+} // namespace barretenberg
@@ -0,0 +1,85 @@
+#include "poseidon2.hpp"
+
+namespace crypto {
+namespace poseidon2 {
+
+namespace {
+
+constexpr size_t RATE = Params::t - 1;
+
+inline fr sbox(fr const& x)
+{
+    fr x4 = x.sqr();
+    x4.self_sqr();
+    return x4 * x;
+}
+
+// M_E = circ(2, 1, 1), i.e. adds the sum of the state to each element
+inline void apply_external_matrix(State& state)
+{
+    fr sum = state[0] + state[1] + state[2];
+    state[0] += sum;
+    state[1] += sum;
+    state[2] += sum;
+}
+
+// M_I = 1 + diag(1, 1, 2)
+inline void apply_internal_matrix(State& state)
+{
+    fr sum = state[0] + state[1] + state[2];
+    state[0] += sum;
+    state[1] += sum;
+    state[2] += state[2] + sum;
+}
+
+inline void full_round(State& state, std::array<fr, Params::t> const& round_constants)
+{
+    for (size_t i = 0; i < Params::t; ++i) {
+        state[i] = sbox(state[i] + round_constants[i]);
+    }
+    apply_external_matrix(state);
+}
+
+} // namespace
+
+State permutation(State const& input)
+{
+    static_assert(Params::t == 3 && Params::d == 5);
+    constexpr size_t half_rounds_f = Params::rounds_f / 2;
+
+    State state = input;
+    apply_external_matrix(state);
+    for (size_t i = 0; i < half_rounds_f; ++i) {
+        full_round(state, Params::round_constants[i]);
+    }
+    for (size_t i = half_rounds_f; i < half_rounds_f + Params::rounds_p; ++i) {
+        state[0] = sbox(state[0] + Params::round_constants[i][0]);
+        apply_internal_matrix(state);
+    }
+    for (size_t i = half_rounds_f + Params::rounds_p; i < Params::num_rounds; ++i) {
+        full_round(state, Params::round_constants[i]);
+    }
+    return state;
+}
+
+fr hash(std::vector<fr> const& inputs)
+{
+    State state = { fr(0), fr(0), fr(uint256_t(inputs.size()) << 64) };
+    size_t i = 0;
+    do {
+        for (size_t j = 0; j < RATE && i < inputs.size(); ++j, ++i) {
+            state[j] += inputs[i];
+        }
+        state = permutation(state);
+    } while (i < inputs.size());
+    return state[0];
+}
+
+fr hash_pair(fr const& lhs, fr const& rhs)
+{
+    State state = { lhs, rhs, fr(uint256_t(2) << 64) };
+    return permutation(state)[0];
+}
+
+} // namespace poseidon2
+} // namespace crypto
@@ -0,0 +1,30 @@
+#pragma once
+#include "poseidon2_params.hpp"
+#include <vector>
+
+namespace crypto {
+namespace poseidon2 {
+
+using Params = Poseidon2Bn254ScalarFieldParams;
+using State = std::array<fr, Params::t>;
+
+/**
+ * The Poseidon2 permutation (https://eprint.iacr.org/2023/323): an external matrix multiplication, rounds_f / 2 full
+ * rounds, rounds_p partial rounds (where only the first element goes through the S-box x^5) and rounds_f / 2 full
+ * rounds.
+ */
+State permutation(State const& input);
+
+/**
+ * Hashes `inputs` with a sponge over the permutation of rate 2 and capacity 1. The capacity element is initialised to
+ * inputs.size() << 64, so inputs of different lengths are separated.
+ */
+fr hash(std::vector<fr> const& inputs);
+
+/**
+ * hash({ lhs, rhs }), a single permutation.
+ */
+fr hash_pair(fr const& lhs, fr const& rhs);
+
+} // namespace poseidon2
+} // namespace crypto
@@ -0,0 +1,42 @@
+#include "poseidon2.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <gtest/gtest.h>
+
+using namespace crypto::poseidon2;
+
+namespace {
+auto& engine = numeric::random::get_debug_engine();
+}
+
+// The test vector of the reference implementation (poseidon2_instance_bn256.rs)
+TEST(crypto_poseidon2, permutation_test_vector)
+{
+    State result = permutation({ fr(0), fr(1), fr(2) });
+
+    EXPECT_EQ(result[0],
+              fr(uint256_t(0x47f760054f4a3033UL, 0x8134334da98ea4f8UL, 0xbcb1929a82650f32UL, 0x0bb61d24daca55eeUL)));
+    EXPECT_EQ(result[1],
+              fr(uint256_t(0x92defe7ff8d03570UL, 0x77a15d3f74ca6549UL, 0xcbcc80214f26a302UL, 0x303b6f7c86d043bfUL)));
+    EXPECT_EQ(result[2],
+              fr(uint256_t(0x86296242cf766ec8UL, 0xe660b145994427ccUL, 0xf8617361c3ba7c52UL, 0x1ed25194542b12eeUL)));
+}
+
+TEST(crypto_poseidon2, hash)
+{
+    EXPECT_EQ(hash({ fr(1), fr(2) }),
+              fr(uint256_t(0x2c525059254e3bfdUL, 0xb327da5ae77038beUL, 0x45ca2554e847d2e5UL, 0x0210752763833e02UL)));
+
+    fr a = fr::random_element(&engine);
+    fr b = fr::random_element(&engine);
+    fr c = fr::random_element(&engine);
+    EXPECT_EQ(hash_pair(a, b), hash({ a, b }));
+
+    // Three inputs take two permutations, absorbing c into the first element of the state
+    State state = permutation({ a, b, fr(uint256_t(3) << 64) });
+    state[0] += c;
+    EXPECT_EQ(hash({ a, b, c }), permutation(state)[0]);
+
+    // Padding with zeros changes the length, and so the hash
+    EXPECT_NE(hash({ a }), hash({ a, fr(0) }));
+    EXPECT_NE(hash({}), hash({ fr(0) }));
+}
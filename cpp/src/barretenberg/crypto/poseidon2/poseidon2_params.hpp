@@ -0,0 +1,225 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <array>
+
+namespace crypto {
+namespace poseidon2 {
+
+using barretenberg::fr;
+using numeric::uint256_t;
+
+/**
+ * Parameters of the Poseidon2 permutation over the bn254 scalar field with a state of 3 elements, as in the reference
+ * implementation (https://github.com/HorizenLabs/poseidon2, poseidon2_instance_bn256.rs).
+ *
+ * The round constants are generated with the Grain LFSR of the Poseidon paper. Partial rounds only add a constant to
+ * the first element, so the other two constants of those rounds are zero.
+ */
+struct Poseidon2Bn254ScalarFieldParams {
+    static constexpr size_t t = 3;
+    static constexpr uint64_t d = 5;
+    static constexpr size_t rounds_f = 8;
+    static constexpr size_t rounds_p = 56;
+    static constexpr size_t num_rounds = rounds_f + rounds_p;
+
+    // The internal matrix is the all-ones matrix plus this diagonal
+    static constexpr std::array<fr, t> internal_matrix_diagonal = { fr(1), fr(1), fr(2) };
+
+    static constexpr std::array<std::array<fr, t>, num_rounds> round_constants{ {
+        { fr(uint256_t(0x59a09a1a97052816UL, 0x7f8fcde48bb4c37aUL, 0x8bddd3a93f7804efUL, 0x1d066a255517b7fdUL)),
+          fr(uint256_t(0xb7238547d32c1610UL, 0xb7c6fef31367b68eUL, 0xac3f089cebcc6120UL, 0x29daefb55f6f2dc6UL)),
+          fr(uint256_t(0x9e8b7ad7b0b4e1d1UL, 0x2572d76f08ec5c4fUL, 0x1ecbd88ad959d701UL, 0x1f2cb1624a78ee00UL)) },
+        { fr(uint256_t(0xdb0672ded84f31e5UL, 0xb11f092a53bbc6e1UL, 0xbd77c0ed3d14aa27UL, 0x0aad2e79f15735f2UL)),
+          fr(uint256_t(0x091ccf1595b43f28UL, 0x37028a98f1dece66UL, 0xd6f661dd4094375fUL, 0x2252624f8617738cUL)),
+          fr(uint256_t(0xd49f4f2c9018d735UL, 0x91c20626524b2b87UL, 0x5a65a84a291da1ffUL, 0x1a24913a928b3848UL)) },
+        { fr(uint256_t(0x4fd6dae1508fc47aUL, 0x0a41515ddff497b1UL, 0x7bfc427b5f11ebb1UL, 0x22fc468f1759b74dUL)),
+          fr(uint256_t(0xefd65515617f6e4dUL, 0xe61956ff0b4121d5UL, 0x9cd026e9c9ca107aUL, 0x1059ca787f1f89edUL)),
+          fr(uint256_t(0xa45cbbfae8b981ceUL, 0x2123011f0bf6f155UL, 0xf61f3536d877de98UL, 0x02be9473358461d8UL)) },
+        { fr(uint256_t(0xa1ff3a441a5084a4UL, 0xaba9b669ac5b8736UL, 0x2778a749c82ed623UL, 0x0ec96c8e32962d46UL)),
+          fr(uint256_t(0x48fb2e4d814df57eUL, 0x5a47a7cdb8c99f96UL, 0x5442d9553c45fa3fUL, 0x292f906e07367740UL)),
+          fr(uint256_t(0x0c63f0b2ffe5657eUL, 0xcc611160a394ea46UL, 0x26c11b9a0f5e39a5UL, 0x274982444157b867UL)) },
+        { fr(uint256_t(0x499573f23597d4b5UL, 0xcedd192f47308731UL, 0xb63e1855bff015b8UL, 0x1a1d063e54b1e764UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xb91b002c5b257c37UL, 0x08235dccc1aa3793UL, 0x839d109562590637UL, 0x26abc66f3fdf8e68UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x0b3c2b12ff4d7be8UL, 0x0754427aabca92a7UL, 0x81a578cfed5aed37UL, 0x0c7c64a9d8873853UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xedd383831354b495UL, 0xba2ebac30dc386b0UL, 0x9e17f0b6d08b2d1eUL, 0x1cf5998769e9fab7UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x7aba0b97e66b0109UL, 0x19828764a9669bc1UL, 0x564ca60461e9e08bUL, 0x0f5e3a8566be31b7UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x42bf3d7a531c976eUL, 0xf359a53a180b7d4bUL, 0x95e60e4db0794a01UL, 0x18df6a9d19ea90d8UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x4e324055fa3123dcUL, 0xd0ea1d3a3b9d25efUL, 0x6e4b782c3c6e601aUL, 0x04f7bf2c5c0538acUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xe55d54628b89ebe6UL, 0xe770c0584aa2328cUL, 0x3c40058523748531UL, 0x29c76ce22255206eUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x00e0e945dbc5ff15UL, 0x65b1b8e9c6108dbeUL, 0xc053659ab4347f5dUL, 0x198d425a45b78e85UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x49d3a9a90c3fdf74UL, 0xa7ff7f6878b3c49dUL, 0x6af3cc79c598a1daUL, 0x25ee27ab6296cd5eUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xc0f88687a96d1381UL, 0x05845d7d0c55b1b2UL, 0x24561001c0b6eb15UL, 0x138ea8e0af41a1e0UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x4013370a01d95687UL, 0x42851b5b9811f2caUL, 0xf6e7c2cba2eefd0eUL, 0x306197fb3fab671eUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x86419eaf00e8f620UL, 0x21db7565e5b42504UL, 0x2b66f0b4894d4f1aUL, 0x1a0c7d52dc32a443UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xaa52997da2c54a9fUL, 0xebfbe5f55163cd6cUL, 0x3ff86a8e5c8bdfccUL, 0x2b46b418de80915fUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xfb46e312b5829f64UL, 0x613a1af5db48e05bUL, 0x01f8b777b9673af9UL, 0x12d3e0dc00858737UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xba338a5cb19b3a1fUL, 0xfb2bf768230f648dUL, 0x70f5002ed21d089fUL, 0x263390cf74dc3a88UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x7d543db52b003dcdUL, 0xf8abb5af40f96f1dUL, 0x0ac884b4ca607ad0UL, 0x0a14f33a5fe668a6UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xd847df829bc683b9UL, 0x27be3a4f01171a1dUL, 0x1a5e86509d68b2daUL, 0x28ead9c586513eabUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xea16cda6e1a7416cUL, 0x888f0ea1abe71cffUL, 0x0972031f1bdb2ac9UL, 0x1c6ab1c328c3c643UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x32346015c5b42c94UL, 0x4f6decd608cb98a9UL, 0x2b2500239f7f8de0UL, 0x1fc7e71bc0b81979UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xe6dd85b93a0ddaa8UL, 0xc0c1e197c952650eUL, 0xe380e0d860298f17UL, 0x03e107eb3a42b2ecUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x454505f6941d78cdUL, 0x46452ca57c08697fUL, 0x69c0d52bf88b772cUL, 0x2d354a251f381a46UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xd14b4606826f794bUL, 0x522551d61606eda3UL, 0xf687ef14bc566d1cUL, 0x094af88ab05d94baUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xd52b2d249d1396f7UL, 0xe1ab5b6f2e3195a9UL, 0x19bcaeabf02f8ca5UL, 0x19705b783bf3d2dcUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x60cef6852271200eUL, 0x8723b16b7d740a3eUL, 0x1fcc33fee54fc5b2UL, 0x09bf4acc3a8bce3fUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x543a073f3f3b5e4eUL, 0x3413732f301f7058UL, 0x50f83c0c8fab6284UL, 0x1803f8200db6013cUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xd41f7fef2faf3e5cUL, 0xbf6fb02d4454c0adUL, 0x30595b160b8d1f38UL, 0x0f80afb5046244deUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x7dc3f98219529d78UL, 0xabcfcf643f4a6feaUL, 0xd77f0088c1cfc964UL, 0x126ee1f8504f15c3UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xef86f991d7d0a591UL, 0x0ffb4ee63175ddf8UL, 0x69bfb3d919552ca1UL, 0x23c203d10cfcc60fUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x7c5a339f7744fb94UL, 0x3dec1ee4eec2cf74UL, 0xec0d09705fa3a630UL, 0x2a2ae15d8b143709UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xb6b5d89081970b2bUL, 0xc3d3b3006cb461bbUL, 0x47e5c381ab6343ecUL, 0x07b60dee586ed6efUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x132cfe583c9311bdUL, 0x8a98a320baa7d152UL, 0x885d95c494c1ae3dUL, 0x27316b559be3edfdUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x2f5f9af0c0342e76UL, 0xef834cc2a743ed66UL, 0xd8937cb2d3f84311UL, 0x1d5c49ba157c32b8UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x7c24bd5940968488UL, 0x09c01bf6979938f6UL, 0x332774e0b850b5ecUL, 0x2f8b124e78163b2fUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x665f75260113b3d5UL, 0x1d4cba6554e51d84UL, 0xdc5b7aa09a9ce21bUL, 0x1e6843a5457416b6UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x1f5bc79f21641d4bUL, 0xa68daf9ac6a189abUL, 0x5fca25c9929c8ad9UL, 0x11cdf00a35f650c5UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xe82b5b9b7eb560bcUL, 0x608b2815c77355b7UL, 0x2ef36e588158d6d4UL, 0x21632de3d3bbc5e4UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x49d7b5c51c18498aUL, 0x255ae48ef2a329e4UL, 0x97b27025fbd245e0UL, 0x0de625758452efbdUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x9b09546ba0838098UL, 0xdd9e1e1c6f0fb6b0UL, 0xe2febfd4d976cc01UL, 0x2ad253c053e75213UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xd35702e38d60b077UL, 0x3dd49cdd13c813b7UL, 0x6ec7681ec39b3be9UL, 0x1d6b169ed63872dcUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xc3a54e706cfef7feUL, 0x0be3ea70a24d5568UL, 0xb9127c4941b67fedUL, 0x1660b740a143664bUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x96a29f10376ccbfeUL, 0xceacdddb12cf8790UL, 0x114f4ca2deef76e0UL, 0x0065a92d1de81f34UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xcf30d50a5871040dUL, 0x353ebe2ccbc4869bUL, 0x7367f823da7d672cUL, 0x1f11f06520253598UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x110852d17df0693eUL, 0x3bd1d1a39b6759baUL, 0xb437ce7b14a2c3ddUL, 0x26596f5c5dd5a5d1UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x6743db15af91860fUL, 0x8539c4163a5f1e70UL, 0x7bf3056efcf8b6d3UL, 0x16f49bc727e45a2fUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xe1a4e7438dd39e5fUL, 0x568feaf7ea8b3dc5UL, 0x9954175efb331bf4UL, 0x1abe1deb45b3e311UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x020d34aea15fba59UL, 0x9f5db92aaec5f102UL, 0xd8993a74ca548b77UL, 0x0e426ccab66984d1UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xa841924303f6a6c6UL, 0x0071684b902d534fUL, 0x4933bd1942053f1fUL, 0x0e7c30c2e2e8957fUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x4c76e1f31d3fc69dUL, 0x6166ded6e3528eadUL, 0x1622708fc7edff1dUL, 0x0812a017ca92cf0aUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x2e276b47cf010d54UL, 0x68afe5026edd7a9cUL, 0xbba949d1db960400UL, 0x21a5ade3df2bc1b5UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x72b1a5233f8749ceUL, 0xbd101945f50e5afeUL, 0xad711bf1a058c6c6UL, 0x01f3035463816c84UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x4dcaa82b0f0c1c8bUL, 0x8bf2f9398dbd0fdfUL, 0x028c2aafc2d06a5eUL, 0x0b115572f038c0e2UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x3460613b6ef59e2fUL, 0x27fc24db42bc910aUL, 0xf0ef255543f50d2eUL, 0x1c38ec0b99b62fd4UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0xb1d0b254d880c53eUL, 0x2f5d314606a297d4UL, 0x425c3ff1f4ac737bUL, 0x1c89c6d9666272e8UL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x8b71e2311bb88f8fUL, 0x21ad4880097a5eb3UL, 0xf6d44008ae4c042aUL, 0x03326e643580356bUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x5bdde2299910a4c9UL, 0x50f27a6434b5dcebUL, 0x67cee9ea0e51e3adUL, 0x268076b0054fb73fUL)),
+          fr(0),
+          fr(0) },
+        { fr(uint256_t(0x78d04aa6f8747ad0UL, 0x5da18ea9d8e4f101UL, 0x626ed93491bda32eUL, 0x1acd63c67fbc9ab1UL)),
+          fr(uint256_t(0xca8c86cd2a28b5a5UL, 0x1bf93375e2323ec3UL, 0xc4e3144be58ef690UL, 0x19f8a5d670e8ab66UL)),
+          fr(uint256_t(0xe1cfbb5f7b9b6893UL, 0x068193ea51f6c92aUL, 0x6efa40d2df10a011UL, 0x1c0dc443519ad7a8UL)) },
+        { fr(uint256_t(0x180e4c3224987d3dUL, 0xfbeab33cb4f6a2c4UL, 0x50fe7190e421dc19UL, 0x14b39e7aa4068dbeUL)),
+          fr(uint256_t(0xafb1e35e28b0795eUL, 0xb820fc519f01f021UL, 0x8f28c63ea6c561b7UL, 0x1d449b71bd826ec5UL)),
+          fr(uint256_t(0x76524dc0a9e987fcUL, 0x89de141689d12522UL, 0x60fa97fe60fe9d8eUL, 0x1ea2c9a89baaddbbUL)) },
+        { fr(uint256_t(0x134d5cefdb3c7ff1UL, 0x591f9a46a0e9c058UL, 0xb57e9c1c3d6a2bd7UL, 0x0478d66d43535a8cUL)),
+          fr(uint256_t(0x1cde5e4a7b00bebeUL, 0x662e26ad86c400b2UL, 0xf608f3b2717f9cd2UL, 0x19272db71eece6a6UL)),
+          fr(uint256_t(0x039be846af134166UL, 0xb2dd1bd66a87ef75UL, 0xc749c746f09208abUL, 0x14226537335cab33UL)) },
+        { fr(uint256_t(0xf912f44961f9a9ceUL, 0xb21c21e4a1c2e823UL, 0x9dfe38c0d976a088UL, 0x01fd6af15956294fUL)),
+          fr(uint256_t(0x5ad8518d4e5f2a57UL, 0xaee2e62ed229ba5aUL, 0x7bca190b8b2cab1aUL, 0x18e5abedd626ec30UL)),
+          fr(uint256_t(0x0e2d54dc1c84fda6UL, 0x97c021a3a409926dUL, 0xabbdffa6d3b35e32UL, 0x0fc1bbceba0590f5UL)) },
+    } };
+};
+
+} // namespace poseidon2
+} // namespace crypto
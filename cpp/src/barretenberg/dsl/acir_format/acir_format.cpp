@@ -3,7 +3,7 @@
 
 namespace acir_format {
 
-void read_witness(Composer& composer, std::vector<barretenberg::fr> witness)
+void read_witness(Composer& composer, std::vector<barretenberg::fr> const& witness)
 {
     composer.variables[0] = 0;
     for (size_t i = 0; i < witness.size(); ++i) {
@@ -472,4 +472,153 @@ void create_circuit_with_witness(Composer& composer, const acir_format& constrai
     }
 }
 
+namespace {
+
+/**
+ * @brief Where a serialized constraint vector starts in the buffer, and its length
+ */
+template <typename T> struct constraint_section {
+    uint8_t const* begin = nullptr;
+    uint32_t size = 0;
+
+    /**
+     * @brief Decode the constraints one at a time, handing each to fn before the next one is read
+     */
+    template <typename Fn> void for_each(Fn&& fn) const
+    {
+        using serialize::read;
+        auto it = begin;
+        for (uint32_t i = 0; i < size; ++i) {
+            T constraint;
+            read(it, constraint);
+            fn(constraint);
+        }
+    }
+};
+
+/**
+ * @brief Record the position of the std::vector<T> at it and advance it past the vector
+ */
+template <typename T> constraint_section<T> skip_section(uint8_t const*& it)
+{
+    using serialize::read;
+    DEBUG_CANARY_READ(it, std::vector<T>);
+    constraint_section<T> section;
+    read(it, section.size);
+    section.begin = it;
+    if constexpr (std::is_same_v<T, poly_triple>) {
+        // Arithmetic gates are the bulk of the buffer and have a fixed size, so jump straight over them
+        static const size_t serialized_size = to_buffer(poly_triple{}).size();
+        it += section.size * serialized_size;
+    } else {
+        for (uint32_t i = 0; i < section.size; ++i) {
+            T constraint;
+            read(it, constraint);
+        }
+    }
+    return section;
+}
+
+void create_circuit_from_buffer_internal(Composer& composer,
+                                         uint8_t const* constraint_system_buf,
+                                         std::vector<fr> const* witness)
+{
+    using serialize::read;
+    auto it = constraint_system_buf;
+
+    uint32_t varnum = 0;
+    std::vector<uint32_t> public_inputs;
+    read(it, varnum);
+    read(it, public_inputs);
+
+    // Gates are added in a different order than the constraints are serialized in, so find where each vector starts
+    // first. This only decodes the (few, small) non-arithmetic constraints.
+    const auto logic_constraints = skip_section<LogicConstraint>(it);
+    const auto range_constraints = skip_section<RangeConstraint>(it);
+    const auto sha256_constraints = skip_section<Sha256Constraint>(it);
+    const auto compute_merkle_root_constraints = skip_section<ComputeMerkleRootConstraint>(it);
+    const auto schnorr_constraints = skip_section<SchnorrConstraint>(it);
+    const auto ecdsa_constraints = skip_section<EcdsaSecp256k1Constraint>(it);
+    const auto blake2s_constraints = skip_section<Blake2sConstraint>(it);
+    const auto keccak_constraints = skip_section<KeccakConstraint>(it);
+    const auto keccak_var_constraints = skip_section<KeccakVarConstraint>(it);
+    const auto pedersen_constraints = skip_section<PedersenConstraint>(it);
+    const auto hash_to_field_constraints = skip_section<HashToFieldConstraint>(it);
+    const auto fixed_base_scalar_mul_constraints = skip_section<FixedBaseScalarMul>(it);
+    const auto constraints = skip_section<poly_triple>(it);
+    const auto block_constraints = skip_section<BlockConstraint>(it);
+
+    if (public_inputs.size() > varnum) {
+        info("create_circuit_from_buffer: too many public inputs!");
+    }
+
+    std::vector<bool> is_public(varnum, false);
+    for (const auto index : public_inputs) {
+        if (index < varnum) {
+            is_public[index] = true;
+        }
+    }
+    for (size_t i = 1; i < varnum; ++i) {
+        if (is_public[i]) {
+            composer.add_public_variable(0);
+        } else {
+            composer.add_variable(0);
+        }
+    }
+
+    if (witness != nullptr) {
+        read_witness(composer, *witness);
+    }
+
+    // Same order as create_circuit
+    constraints.for_each([&](const auto& constraint) { composer.create_poly_gate(constraint); });
+    logic_constraints.for_each([&](const auto& constraint) {
+        create_logic_gate(
+            composer, constraint.a, constraint.b, constraint.result, constraint.num_bits, constraint.is_xor_gate);
+    });
+    range_constraints.for_each([&](const auto& constraint) {
+        composer.create_range_constraint(constraint.witness, constraint.num_bits, "");
+    });
+    sha256_constraints.for_each([&](const auto& constraint) { create_sha256_constraints(composer, constraint); });
+    compute_merkle_root_constraints.for_each(
+        [&](const auto& constraint) { create_compute_merkle_root_constraint(composer, constraint); });
+    schnorr_constraints.for_each(
+        [&](const auto& constraint) { create_schnorr_verify_constraints(composer, constraint); });
+    ecdsa_constraints.for_each([&](const auto& constraint) {
+        create_ecdsa_verify_constraints(composer, constraint, witness != nullptr);
+    });
+    blake2s_constraints.for_each([&](const auto& constraint) { create_blake2s_constraints(composer, constraint); });
+    keccak_constraints.for_each([&](const auto& constraint) { create_keccak_constraints(composer, constraint); });
+    keccak_var_constraints.for_each(
+        [&](const auto& constraint) { create_keccak_var_constraints(composer, constraint); });
+    pedersen_constraints.for_each([&](const auto& constraint) { create_pedersen_constraint(composer, constraint); });
+    fixed_base_scalar_mul_constraints.for_each(
+        [&](const auto& constraint) { create_fixed_base_constraint(composer, constraint); });
+    hash_to_field_constraints.for_each(
+        [&](const auto& constraint) { create_hash_to_field_constraints(composer, constraint); });
+    block_constraints.for_each([&](const auto& constraint) { create_block_constraints(composer, constraint); });
+}
+
+} // namespace
+
+void create_circuit_from_buffer(Composer& composer, uint8_t const* constraint_system_buf)
+{
+    create_circuit_from_buffer_internal(composer, constraint_system_buf, nullptr);
+}
+
+Composer create_circuit_from_buffer(uint8_t const* constraint_system_buf,
+                                    std::unique_ptr<proof_system::ReferenceStringFactory>&& crs_factory)
+{
+    Composer composer(std::move(crs_factory));
+    create_circuit_from_buffer_internal(composer, constraint_system_buf, nullptr);
+    return composer;
+}
+
+void create_circuit_with_witness_from_buffer(Composer& composer,
+                                             uint8_t const* constraint_system_buf,
+                                             std::vector<fr> const& witness)
+{
+    create_circuit_from_buffer_internal(composer, constraint_system_buf, &witness);
+}
+
 } // namespace acir_format
@@ -41,7 +41,7 @@ struct acir_format {
     friend bool operator==(acir_format const& lhs, acir_format const& rhs) = default;
 };
 
-void read_witness(Composer& composer, std::vector<barretenberg::fr> witness);
+void read_witness(Composer& composer, std::vector<barretenberg::fr> const& witness);
 
 void create_circuit(Composer& composer, const acir_format& constraint_system);
 
@@ -56,6 +56,21 @@ Composer create_circuit_with_witness(const acir_format& constraint_system, std::
 
 void create_circuit_with_witness(Composer& composer, const acir_format& constraint_system, std::vector<fr> witness);
 
+/**
+ * The create_circuit variants below take a serialized acir_format (as written by write()) and add each constraint to
+ * the composer as soon as it is decoded, instead of going through from_buffer<acir_format>. The constraint vectors are
+ * never materialised, so peak memory is the composer's own. The resulting circuit is identical to the one built from
+ * the deserialized struct.
+ */
+void create_circuit_from_buffer(Composer& composer, uint8_t const* constraint_system_buf);
+
+Composer create_circuit_from_buffer(uint8_t const* constraint_system_buf,
+                                    std::unique_ptr<proof_system::ReferenceStringFactory>&& crs_factory);
+
+void create_circuit_with_witness_from_buffer(Composer& composer,
+                                             uint8_t const* constraint_system_buf,
+                                             std::vector<fr> const& witness);
+
 // Serialisation
 template <typename B> inline void read(B& buf, acir_format& data)
 {
@@ -265,3 +265,60 @@ TEST(acir_format, test_schnorr_verify_small_range)
 
     EXPECT_EQ(verifier.verify_proof(proof), true);
 }
+
+TEST(acir_format, create_circuit_from_buffer_matches_deserialized)
+{
+    // fn main(x : u32, y : pub u32) { let z = x ^ y; constrain z != 10; }, as in test_logic_gate_from_noir_circuit
+    acir_format::acir_format constraint_system{
+        .varnum = 7,
+        .public_inputs = { 2 },
+        .fixed_base_scalar_mul_constraints = {},
+        .logic_constraints = { { .a = 1, .b = 2, .result = 3, .num_bits = 32, .is_xor_gate = 1 } },
+        .range_constraints = { { .witness = 1, .num_bits = 32 }, { .witness = 2, .num_bits = 32 } },
+        .schnorr_constraints = {},
+        .ecdsa_constraints = {},
+        .sha256_constraints = {},
+        .blake2s_constraints = {},
+        .keccak_constraints = {},
+        .keccak_var_constraints = {},
+        .hash_to_field_constraints = {},
+        .pedersen_constraints = {},
+        .compute_merkle_root_constraints = {},
+        .block_constraints = {},
+        .constraints = { { .a = 3, .b = 4, .c = 0, .q_m = 0, .q_l = 1, .q_r = -1, .q_o = 0, .q_c = -10 },
+                         { .a = 4, .b = 5, .c = 6, .q_m = 1, .q_l = 0, .q_r = 0, .q_o = -1, .q_c = 0 },
+                         { .a = 4, .b = 6, .c = 4, .q_m = 1, .q_l = 0, .q_r = 0, .q_o = -1, .q_c = 0 },
+                         { .a = 6, .b = 0, .c = 0, .q_m = 0, .q_l = -1, .q_r = 0, .q_o = 0, .q_c = 1 } },
+    };
+    std::vector<fr> witness{ 5, 10, 15, 5, fr(5).invert(), 1 };
+    auto buffer = to_buffer(constraint_system);
+
+    auto expect_same_circuit = [](acir_format::Composer const& expected, acir_format::Composer const& actual) {
+        EXPECT_EQ(actual.get_num_gates(), expected.get_num_gates());
+        EXPECT_EQ(actual.public_inputs, expected.public_inputs);
+        EXPECT_EQ(actual.variables, expected.variables);
+        EXPECT_EQ(actual.real_variable_index, expected.real_variable_index);
+        EXPECT_EQ(actual.w_l, expected.w_l);
+        EXPECT_EQ(actual.w_r, expected.w_r);
+        EXPECT_EQ(actual.w_o, expected.w_o);
+        EXPECT_EQ(actual.w_4, expected.w_4);
+        EXPECT_EQ(actual.selectors, expected.selectors);
+    };
+
+    acir_format::Composer expected_composer;
+    acir_format::create_circuit(expected_composer, constraint_system);
+    acir_format::Composer composer;
+    acir_format::create_circuit_from_buffer(composer, buffer.data());
+    expect_same_circuit(expected_composer, composer);
+
+    acir_format::Composer expected_composer_with_witness;
+    acir_format::create_circuit_with_witness(expected_composer_with_witness, constraint_system, witness);
+    acir_format::Composer composer_with_witness;
+    acir_format::create_circuit_with_witness_from_buffer(composer_with_witness, buffer.data(), witness);
+    expect_same_circuit(expected_composer_with_witness, composer_with_witness);
+
+    auto prover = composer_with_witness.create_ultra_with_keccak_prover();
+    auto proof = prover.construct_proof();
+    auto verifier = composer_with_witness.create_ultra_with_keccak_verifier();
+    EXPECT_EQ(verifier.verify_proof(proof), true);
+}
@@ -29,9 +29,8 @@ size_t get_solidity_verifier(uint8_t const* g2x, uint8_t const* vk_buf, uint8_t*
 
 uint32_t get_exact_circuit_size(uint8_t const* constraint_system_buf)
 {
-    auto constraint_system = from_buffer<acir_format::acir_format>(constraint_system_buf);
     auto crs_factory = std::make_unique<proof_system::ReferenceStringFactory>();
-    auto composer = create_circuit(constraint_system, std::move(crs_factory));
+    auto composer = acir_format::create_circuit_from_buffer(constraint_system_buf, std::move(crs_factory));
 
     auto num_gates = composer.get_num_gates();
     return static_cast<uint32_t>(num_gates);
@@ -39,21 +38,18 @@ uint32_t get_exact_circuit_size(uint8_t const* constraint_system_buf)
 
 uint32_t get_total_circuit_size(uint8_t const* constraint_system_buf)
 {
-    auto constraint_system = from_buffer<acir_format::acir_format>(constraint_system_buf);
     auto crs_factory = std::make_unique<proof_system::ReferenceStringFactory>();
-    auto composer = create_circuit(constraint_system, std::move(crs_factory));
+    auto composer = acir_format::create_circuit_from_buffer(constraint_system_buf, std::move(crs_factory));
 
     return static_cast<uint32_t>(composer.get_total_circuit_size());
 }
 
 size_t init_proving_key(uint8_t const* constraint_system_buf, uint8_t const** pk_buf)
 {
-    auto constraint_system = from_buffer<acir_format::acir_format>(constraint_system_buf);
-
     // We know that we don't actually need any CRS to create a proving key, so just feed in a nothing.
     // Hacky, but, right now it needs *something*.
     auto crs_factory = std::make_unique<ReferenceStringFactory>();
-    auto composer = create_circuit(constraint_system, std::move(crs_factory));
+    auto composer = acir_format::create_circuit_from_buffer(constraint_system_buf, std::move(crs_factory));
     auto proving_key = composer.compute_proving_key();
 
     auto buffer = to_buffer(*proving_key);
@@ -98,8 +94,6 @@ size_t new_proof(void* pippenger,
                  uint8_t const* witness_buf,
                  uint8_t** proof_data_buf)
 {
-    auto constraint_system = from_buffer<acir_format::acir_format>(constraint_system_buf);
-
     std::shared_ptr<ProverReferenceString> crs;
     plonk::proving_key_data pk_data;
     read(pk_buf, pk_data);
@@ -113,7 +107,7 @@ size_t new_proof(void* pippenger,
 
     acir_format::Composer composer(proving_key, nullptr);
 
-    create_circuit_with_witness(composer, constraint_system, witness);
+    acir_format::create_circuit_with_witness_from_buffer(composer, constraint_system_buf, witness);
 
     auto prover = composer.create_ultra_with_keccak_prover();
 
@@ -132,14 +126,13 @@ bool verify_proof(
 #ifndef __wasm__
     try {
 #endif
-        auto constraint_system = from_buffer<acir_format::acir_format>(constraint_system_buf);
         auto crs = std::make_shared<VerifierMemReferenceString>(g2x);
         plonk::verification_key_data vk_data;
         read(vk_buf, vk_data);
         auto verification_key = std::make_shared<proof_system::plonk::verification_key>(std::move(vk_data), crs);
 
         acir_format::Composer composer(nullptr, verification_key);
-        create_circuit(composer, constraint_system);
+        acir_format::create_circuit_from_buffer(composer, constraint_system_buf);
         plonk::proof pp = { std::vector<uint8_t>(proof, proof + length) };
 
         auto verifier = composer.create_ultra_with_keccak_verifier();
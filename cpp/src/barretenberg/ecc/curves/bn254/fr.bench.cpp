@@ -265,6 +265,31 @@ void mul_bench(State& state) noexcept
 }
 BENCHMARK(mul_bench);
 
+// The SIMD128 kernel that wasm builds with WASM_SIMD compile to i64x2.extmul, against mul_bench
+fr mul_simd_impl(const fr& x, const fr& y)
+{
+    fr acc = x;
+    for (size_t i = 0; i < NUM_POINTS; ++i) {
+        acc = acc.montgomery_mul_simd(y);
+    }
+    return acc;
+}
+
+void mul_simd_bench(State& state) noexcept
+{
+    uint64_t clocks = 0;
+    uint64_t count = 0;
+    for (auto _ : state) {
+        uint64_t before = rdtsc();
+        DoNotOptimize(mul_simd_impl(accx, accy));
+        clocks += (rdtsc() - before);
+        ++count;
+    }
+    double average = static_cast<double>(clocks) / (static_cast<double>(count) * double(NUM_POINTS));
+    std::cout << "mul simd clocks per operation = " << average << std::endl;
+}
+BENCHMARK(mul_simd_bench);
+
 fr self_add_impl(const fr& x, fr& y)
 {
     fr acc = x;
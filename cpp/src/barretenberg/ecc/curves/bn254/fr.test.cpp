@@ -64,6 +64,28 @@ TEST(fr, mul)
     EXPECT_EQ((result == expected), true);
 }
 
+TEST(fr, montgomery_mul_simd)
+{
+    constexpr uint256_t twice_modulus_minus_one = fr::modulus + fr::modulus - 1;
+    const fr max{ twice_modulus_minus_one.data[0],
+                  twice_modulus_minus_one.data[1],
+                  twice_modulus_minus_one.data[2],
+                  twice_modulus_minus_one.data[3] };
+    const fr edge_cases[]{ fr::zero(), fr::one(), fr(-1), max };
+    for (const auto& a : edge_cases) {
+        for (const auto& b : edge_cases) {
+            EXPECT_EQ(a.montgomery_mul_simd(b).reduce_once(), (a * b).reduce_once());
+        }
+    }
+    for (size_t i = 0; i < 1000; ++i) {
+        const fr a = fr::random_element();
+        const fr b = fr::random_element();
+        const fr result = a.montgomery_mul_simd(b);
+        EXPECT_LT(uint256_t(result), fr::modulus + fr::modulus);
+        EXPECT_EQ(result.reduce_once(), (a * b).reduce_once());
+    }
+}
+
 TEST(fr, sqr)
 {
     fr a{ 0x95f946723a1fc34f, 0x641ec0482fc40bb9, 0xb8d645bc49dd513d, 0x1c1bffd317599dbc };
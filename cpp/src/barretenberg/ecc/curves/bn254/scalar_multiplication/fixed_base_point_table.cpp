@@ -0,0 +1,187 @@
+#include "./fixed_base_point_table.hpp"
+#include "./pippenger.hpp"
+
+#include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+
+#include <array>
+#include <vector>
+
+#include "../../../groups/wnaf.hpp"
+
+namespace barretenberg {
+namespace scalar_multiplication {
+
+FixedBasePointTable::FixedBasePointTable(g1::affine_element* point_table, size_t num_points, size_t num_copies)
+    : point_table_(point_table)
+    , num_points_(num_points)
+    , num_copies_(std::max(num_copies, 1UL))
+    , bits_per_bucket_(get_optimal_bucket_width(num_points_ * num_copies_))
+    , num_rounds_((WNAF_SIZE(bits_per_bucket_ + 1) + num_copies_ - 1) / num_copies_)
+{
+    copies_ = point_table_alloc<g1::affine_element>(num_points_ * num_copies_);
+
+    // Copy g is 2^{shift * g} times the original point. Copies are built by doubling in projective form and
+    // normalised a block at a time, so that they share one inversion.
+    constexpr size_t BLOCK_SIZE = 1024;
+    const size_t shift = (bits_per_bucket_ + 1) * num_rounds_;
+    const size_t num_entries = 2 * num_points_;
+    const size_t num_threads = max_threads::compute_num_threads();
+    parallel_for(num_threads, [&](size_t thread_index) {
+        const size_t start = (thread_index * num_entries) / num_threads;
+        const size_t end = ((thread_index + 1) * num_entries) / num_threads;
+        std::vector<g1::element> scaled(BLOCK_SIZE * (num_copies_ - 1));
+        for (size_t block_start = start; block_start < end; block_start += BLOCK_SIZE) {
+            const size_t block_end = std::min(block_start + BLOCK_SIZE, end);
+            for (size_t i = block_start; i < block_end; ++i) {
+                copies_[i * num_copies_] = point_table_[i];
+                g1::element accumulator(point_table_[i]);
+                for (size_t g = 1; g < num_copies_; ++g) {
+                    for (size_t j = 0; j < shift; ++j) {
+                        accumulator.self_dbl();
+                    }
+                    scaled[(i - block_start) * (num_copies_ - 1) + g - 1] = accumulator;
+                }
+            }
+            if (num_copies_ == 1) {
+                continue;
+            }
+            g1::element::batch_normalize(&scaled[0], (block_end - block_start) * (num_copies_ - 1));
+            for (size_t i = block_start; i < block_end; ++i) {
+                for (size_t g = 1; g < num_copies_; ++g) {
+                    const g1::element& point = scaled[(i - block_start) * (num_copies_ - 1) + g - 1];
+                    copies_[i * num_copies_ + g] = g1::affine_element(point.x, point.y);
+                }
+            }
+        }
+    });
+}
+
+FixedBasePointTable::~FixedBasePointTable()
+{
+    aligned_free(copies_);
+}
+
+size_t FixedBasePointTable::get_memory_size(size_t num_points, size_t num_copies)
+{
+    return point_table_buf_size<g1::affine_element>(num_points * num_copies);
+}
+
+bool FixedBasePointTable::is_worthwhile(size_t num_initial_points) const
+{
+    return num_initial_points <= num_points_ && 2 * num_initial_points > num_points_;
+}
+
+bool FixedBasePointTable::can_multiply(size_t num_initial_points, const pippenger_runtime_state& state) const
+{
+    if (!is_worthwhile(num_initial_points)) {
+        return false;
+    }
+    // The schedule of the largest power of two of the points, which is what one pass multiplies, has to fit in the
+    // state, and so do the 2^bits_per_bucket buckets per thread
+    const size_t num_slice_points = static_cast<size_t>(1ULL << numeric::get_msb(num_initial_points));
+    const size_t num_schedule_points = 2 * num_slice_points * num_copies_;
+    const auto state_points = static_cast<size_t>(state.num_points);
+    const size_t state_rounds =
+        scalar_multiplication::get_num_rounds(static_cast<size_t>(1ULL << numeric::get_msb(state_points)));
+    return state_points >= num_schedule_points && state_points * state_rounds >= num_schedule_points * num_rounds_ &&
+           get_optimal_bucket_width(state.get_max_num_initial_points()) >= bits_per_bucket_;
+}
+
+/**
+ * Computes the point schedule of a multiplication of the first `num_initial_points` points into `state`.
+ *
+ * This is compute_wnaf_states, except that each scalar's windows are spread over the copies of its point: window u
+ * (of weight 2^{(c + 1) * u}) goes to copy u / r, in round r - 1 - u % r. The window's weight is then the copy's scale
+ * times the 2^{(c + 1) * (r - 1 - round)} that the doublings between rounds contribute. Every copy has an entry in
+ * every round, which is empty (all ones, sorted past every bucket) when it has no window. The skew applies to copy 0.
+ */
+void FixedBasePointTable::compute_wnaf_states(pippenger_runtime_state& state,
+                                              const fr* scalars,
+                                              size_t num_initial_points) const
+{
+    constexpr size_t MAX_NUM_ROUNDS = 256;
+    constexpr size_t MAX_NUM_THREADS = 128;
+    constexpr uint64_t EMPTY_ENTRY = 0xffffffffffffffffULL;
+    const size_t num_points = 2 * num_initial_points * num_copies_;
+    const size_t wnaf_bits = bits_per_bucket_ + 1;
+    const size_t num_windows = WNAF_SIZE(wnaf_bits);
+    const size_t num_threads = max_threads::compute_num_threads();
+    const size_t num_initial_points_per_thread = num_initial_points / num_threads;
+    std::array<std::array<uint64_t, MAX_NUM_ROUNDS>, MAX_NUM_THREADS> thread_round_counts;
+    for (size_t i = 0; i < num_threads; ++i) {
+        for (size_t j = 0; j < num_rounds_; ++j) {
+            thread_round_counts[i][j] = 0;
+        }
+    }
+    parallel_for(num_threads, [&](size_t i) {
+        std::array<uint64_t, MAX_NUM_ROUNDS> wnaf;
+        std::array<uint64_t, MAX_NUM_ROUNDS> window_counts{};
+        fr T0;
+        for (size_t j = i * num_initial_points_per_thread; j < (i + 1) * num_initial_points_per_thread; ++j) {
+            T0 = scalars[j].from_montgomery_form();
+            fr::split_into_endomorphism_scalars(T0, T0, *(fr*)&T0.data[2]);
+
+            for (size_t endo = 0; endo < 2; ++endo) {
+                const size_t entry = (2 * j + endo) * num_copies_;
+                // The wnaf holds the most significant window first
+                wnaf::fixed_wnaf_with_counts(
+                    &T0.data[2 * endo], &wnaf[0], state.skew_table[entry], &window_counts[0], 0, 1, wnaf_bits);
+                for (size_t g = 0; g < num_copies_; ++g) {
+                    if (g > 0) {
+                        state.skew_table[entry + g] = false;
+                    }
+                    const auto point_index = static_cast<uint64_t>(entry + g) << 32ULL;
+                    for (size_t round = 0; round < num_rounds_; ++round) {
+                        const size_t window = g * num_rounds_ + (num_rounds_ - 1 - round);
+                        uint64_t schedule = EMPTY_ENTRY;
+                        if (window < num_windows && wnaf[num_windows - 1 - window] != EMPTY_ENTRY) {
+                            schedule = wnaf[num_windows - 1 - window] | point_index;
+                            ++thread_round_counts[i][round];
+                        }
+                        state.point_schedule[round * num_points + entry + g] = schedule;
+                    }
+                }
+            }
+        }
+    });
+
+    for (size_t i = 0; i < num_rounds_; ++i) {
+        state.round_counts[i] = 0;
+    }
+    for (size_t i = 0; i < num_threads; ++i) {
+        for (size_t j = 0; j < num_rounds_; ++j) {
+            state.round_counts[j] += thread_round_counts[i][j];
+        }
+    }
+}
+
+g1::element FixedBasePointTable::pippenger_unsafe(fr* scalars,
+                                                  size_t num_initial_points,
+                                                  pippenger_runtime_state& state) const
+{
+    // see scalar_multiplication::pippenger
+    const size_t threshold = std::max(max_threads::compute_num_threads() * 8, 8UL);
+    if (num_initial_points <= threshold || !can_multiply(num_initial_points, state)) {
+        return scalar_multiplication::pippenger_unsafe(scalars, point_table_, num_initial_points, state);
+    }
+
+    const size_t num_slice_points = static_cast<size_t>(1ULL << numeric::get_msb(num_initial_points));
+    const size_t num_schedule_points = 2 * num_slice_points * num_copies_;
+    compute_wnaf_states(state, scalars, num_slice_points);
+    organize_buckets(state.point_schedule, num_schedule_points, num_rounds_, bits_per_bucket_);
+    g1::element result =
+        evaluate_pippenger_rounds(state, copies_, num_schedule_points, num_rounds_, bits_per_bucket_, false);
+
+    if (num_slice_points != num_initial_points) {
+        result += scalar_multiplication::pippenger_unsafe(scalars + num_slice_points,
+                                                          point_table_ + 2 * num_slice_points,
+                                                          num_initial_points - num_slice_points,
+                                                          state);
+    }
+    return result;
+}
+
+} // namespace scalar_multiplication
+} // namespace barretenberg
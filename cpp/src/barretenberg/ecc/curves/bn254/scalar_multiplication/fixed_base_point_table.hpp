@@ -0,0 +1,82 @@
+#pragma once
+#include "./runtime_states.hpp"
+#include "./scalar_multiplication.hpp"
+
+namespace barretenberg {
+namespace scalar_multiplication {
+
+/**
+ * A precomputed form of a fixed pippenger point table (e.g. the SRS), for faster multi-scalar multiplications over it.
+ *
+ * Pippenger processes each 127-bit half scalar in R = ceil(127 / (c + 1)) windows of c + 1 bits, one round per window,
+ * with c + 1 doublings of the accumulator between rounds. Each round ends with a reduction over all 2^c buckets.
+ *
+ * Here every point P (and its endomorphism image) is also stored as `num_copies` scaled copies
+ * P_g = 2^{(c + 1) * r * g} * P, where r = ceil(R / num_copies). Window u of a scalar goes to copy u / r, in round
+ * u % r, so a multiplication only needs r rounds. Each round sees num_copies times as many points, so the bucket
+ * width c is chosen for 2 * num_points * num_copies points rather than 2 * num_points. The result is fewer bucket
+ * reductions, fewer doublings and wider windows, at the cost of `num_copies` times the memory for the table. The
+ * runtime state also has to be sized for num_points * num_copies points (see get_runtime_state_size()).
+ * With num_copies >= R, a multiplication is a single bucket pass with no doublings at all.
+ *
+ * Entry (2 * i + e) * num_copies + g of the table is copy g of entry 2 * i + e of the pippenger table. This keeps the
+ * points of any prefix of the table contiguous, so the skew of a scalar can be applied to copy 0 by
+ * evaluate_pippenger_rounds as usual.
+ *
+ * Like pippenger_unsafe, multiplications do not handle the incomplete addition edge cases, so this is only for
+ * linearly independent points such as the SRS.
+ */
+class FixedBasePointTable {
+  public:
+    /**
+     * Builds the copies of the first `num_points` points of `point_table`, which must outlive this object.
+     */
+    FixedBasePointTable(g1::affine_element* point_table, size_t num_points, size_t num_copies);
+
+    FixedBasePointTable(const FixedBasePointTable& other) = delete;
+    FixedBasePointTable& operator=(const FixedBasePointTable& other) = delete;
+
+    ~FixedBasePointTable();
+
+    /**
+     * Multiplies the first `num_initial_points` points by `scalars`. Runs regular pippenger_unsafe over the original
+     * point table if the input is too small to benefit, or if `state` can't hold it (see can_multiply()).
+     */
+    g1::element pippenger_unsafe(fr* scalars, size_t num_initial_points, pippenger_runtime_state& state) const;
+
+    /**
+     * Whether inputs of this size should use the copies. The bucket width is fixed by the table size, so inputs much
+     * smaller than the table are better served by regular pippenger.
+     */
+    bool is_worthwhile(size_t num_initial_points) const;
+
+    // Whether pippenger_unsafe can use the copies for this input size and runtime state
+    bool can_multiply(size_t num_initial_points, const pippenger_runtime_state& state) const;
+
+    // The runtime state size (in initial points) that can_multiply() accepts for every worthwhile input
+    size_t get_runtime_state_size() const { return num_points_ * num_copies_; }
+
+    size_t get_num_points() const { return num_points_; }
+
+    size_t get_num_copies() const { return num_copies_; }
+
+    size_t get_num_rounds() const { return num_rounds_; }
+
+    size_t get_bits_per_bucket() const { return bits_per_bucket_; }
+
+    // Bytes taken by the copies of a table of num_points points
+    static size_t get_memory_size(size_t num_points, size_t num_copies);
+
+  private:
+    void compute_wnaf_states(pippenger_runtime_state& state, const fr* scalars, size_t num_initial_points) const;
+
+    g1::affine_element* point_table_;
+    g1::affine_element* copies_;
+    size_t num_points_;
+    size_t num_copies_;
+    size_t bits_per_bucket_;
+    size_t num_rounds_;
+};
+
+} // namespace scalar_multiplication
+} // namespace barretenberg
@@ -1,4 +1,5 @@
 #include "pippenger.hpp"
+#include "fixed_base_point_table.hpp"
 #include "barretenberg/srs/io.hpp"
 namespace barretenberg {
 namespace scalar_multiplication {
@@ -6,6 +7,7 @@ namespace scalar_multiplication {
 Pippenger::Pippenger(g1::affine_element* points, size_t num_points)
     : monomials_(points)
     , num_points_(num_points)
+    , capacity_(num_points)
 {
     io::byteswap(&monomials_[0], num_points * 64);
     scalar_multiplication::generate_pippenger_point_table(monomials_, monomials_, num_points);
@@ -13,6 +15,7 @@ Pippenger::Pippenger(g1::affine_element* points, size_t num_points)
 
 Pippenger::Pippenger(uint8_t const* points, size_t num_points)
     : num_points_(num_points)
+    , capacity_(num_points)
 {
     monomials_ = point_table_alloc<g1::affine_element>(num_points);
 
@@ -21,20 +24,55 @@ Pippenger::Pippenger(uint8_t const* points, size_t num_points)
 }
 
 Pippenger::Pippenger(std::string const& path, size_t num_points)
+    : Pippenger(path, num_points, num_points)
+{}
+
+Pippenger::Pippenger(std::string const& path, size_t num_points, size_t capacity, Pippenger const* prefix)
     : num_points_(num_points)
+    , capacity_(std::max(capacity, num_points))
 {
-    monomials_ = point_table_alloc<g1::affine_element>(num_points);
+    monomials_ = point_table_alloc<g1::affine_element>(capacity_);
 
-    barretenberg::io::read_transcript_g1(monomials_, num_points, path);
-    barretenberg::scalar_multiplication::generate_pippenger_point_table(monomials_, monomials_, num_points);
+    size_t num_copied = 0;
+    if (prefix != nullptr) {
+        num_copied = std::min(prefix->num_points_, num_points);
+        memcpy((void*)monomials_, (void*)prefix->monomials_, num_copied * 2 * sizeof(g1::affine_element));
+    }
+    barretenberg::io::read_transcript_g1_point_table(monomials_, num_points, path, num_copied);
+}
+
+bool Pippenger::grow(std::string const& path, size_t num_points)
+{
+    if (num_points <= num_points_) {
+        return true;
+    }
+    if (num_points > capacity_) {
+        return false;
+    }
+    barretenberg::io::read_transcript_g1_point_table(monomials_, num_points, path, num_points_);
+    num_points_ = num_points;
+    return true;
 }
 
 g1::element Pippenger::pippenger_unsafe(fr* scalars, size_t from, size_t range)
 {
+    if (from == 0 && fixed_base_table_ != nullptr && fixed_base_table_->is_worthwhile(range)) {
+        scalar_multiplication::pippenger_runtime_state state(fixed_base_table_->get_runtime_state_size());
+        return fixed_base_table_->pippenger_unsafe(scalars, range, state);
+    }
     scalar_multiplication::pippenger_runtime_state state(range);
     return scalar_multiplication::pippenger_unsafe(scalars, monomials_ + from * 2, range, state);
 }
 
+void Pippenger::precompute_fixed_base(size_t num_copies)
+{
+    if (fixed_base_table_ != nullptr && fixed_base_table_->get_num_points() == num_points_ &&
+        fixed_base_table_->get_num_copies() == num_copies) {
+        return;
+    }
+    fixed_base_table_ = std::make_shared<const FixedBasePointTable>(monomials_, num_points_, num_copies);
+}
+
 Pippenger::~Pippenger()
 {
     free(monomials_);
@@ -3,20 +3,17 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/max_threads.hpp"
 
-#ifndef NO_MULTITHREADING
-#include <omp.h>
-#endif
+#include <memory>
+
 
 namespace barretenberg {
 namespace scalar_multiplication {
 
+class FixedBasePointTable;
+
 inline size_t point_table_size(size_t num_points)
 {
-#ifndef NO_MULTITHREADING
     const size_t num_threads = max_threads::compute_num_threads();
-#else
-    const size_t num_threads = 1;
-#endif
     const size_t prefetch_overflow = 16 * num_threads;
 
     return 2 * num_points + prefetch_overflow;
@@ -45,17 +42,46 @@ class Pippenger {
 
     Pippenger(std::string const& path, size_t num_points);
 
+    /**
+     * Allocates a point table with room for `capacity` points and loads the first `num_points` from `path`.
+     * If `prefix` is given, its already converted points are copied instead of being re-read from disk.
+     */
+    Pippenger(std::string const& path, size_t num_points, size_t capacity, Pippenger const* prefix = nullptr);
+
+    Pippenger(const Pippenger& other) = delete;
+    Pippenger& operator=(const Pippenger& other) = delete;
+
     ~Pippenger();
 
+    /**
+     * Extend the point table in place to `num_points`, reading only the missing tail from `path`.
+     * Returns false, leaving the table untouched, if the allocation has no headroom for the extra points.
+     * Points below the current size are never modified, so pointers into the table remain valid.
+     */
+    bool grow(std::string const& path, size_t num_points);
+
     g1::element pippenger_unsafe(fr* scalars, size_t from, size_t range);
 
+    /**
+     * Precompute `num_copies` scaled copies of every point, trading memory for faster multiplications (see
+     * FixedBasePointTable). Does nothing if the current precomputation already covers every point with as many copies.
+     * The precomputation views this object's points, so holders of it must not outlive this object.
+     */
+    void precompute_fixed_base(size_t num_copies);
+
+    std::shared_ptr<const FixedBasePointTable> get_fixed_base_table() const { return fixed_base_table_; }
+
     g1::affine_element* get_point_table() const { return monomials_; }
 
     size_t get_num_points() const { return num_points_; }
 
+    size_t get_capacity() const { return capacity_; }
+
   private:
     g1::affine_element* monomials_;
     size_t num_points_;
+    size_t capacity_;
+    std::shared_ptr<const FixedBasePointTable> fixed_base_table_;
 };
 
 } // namespace scalar_multiplication
@@ -2,48 +2,75 @@
 
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 
-#ifndef NO_MULTITHREADING
-#include <omp.h>
-#endif
 
 namespace barretenberg {
 namespace scalar_multiplication {
 
+namespace {
+constexpr size_t MAX_NUM_ROUNDS = 256;
+
+/**
+ * The buffer sizes, in bytes, of a runtime state for num_initial_points. Both the constructor and get_memory_size use
+ * them, so a memory cap is checked against exactly what gets allocated.
+ */
+struct runtime_state_sizes {
+    size_t num_points;
+    size_t num_rounds;
+    size_t num_threads;
+    size_t point_schedule;
+    size_t skew_table;
+    size_t point_pairs;
+    size_t scratch_space;
+    size_t bucket_counts;
+    size_t bucket_empty_status;
+    size_t round_counts;
+
+    explicit runtime_state_sizes(const size_t num_initial_points)
+        : num_points(num_initial_points * 2)
+        , num_rounds(static_cast<size_t>(get_num_rounds(static_cast<size_t>(1ULL << numeric::get_msb(num_points)))))
+        , num_threads(max_threads::compute_num_threads())
+    {
+        const size_t num_buckets = static_cast<size_t>(1U << get_optimal_bucket_width(num_initial_points));
+        const size_t prefetch_overflow = 16 * num_threads;
+        point_schedule = (num_points * num_rounds + prefetch_overflow) * sizeof(uint64_t);
+        skew_table = pad(num_points * sizeof(bool), 64);
+        point_pairs = (num_points * 2 + num_threads * 16) * sizeof(g1::affine_element);
+        scratch_space = num_points * sizeof(g1::affine_element);
+        bucket_counts = num_threads * num_buckets * sizeof(uint32_t);
+        bucket_empty_status = num_threads * num_buckets * sizeof(bool);
+        round_counts = MAX_NUM_ROUNDS * sizeof(uint64_t);
+    }
+
+    // point_pairs_1/2 and bucket_counts/bit_counts are two buffers each
+    size_t total() const
+    {
+        return point_schedule + skew_table + 2 * point_pairs + scratch_space + 2 * bucket_counts +
+               bucket_empty_status + round_counts;
+    }
+};
+} // namespace
+
 pippenger_runtime_state::pippenger_runtime_state(const size_t num_initial_points)
 {
-    constexpr size_t MAX_NUM_ROUNDS = 256;
-    num_points = num_initial_points * 2;
-    const size_t num_points_floor = static_cast<size_t>(1ULL << (numeric::get_msb(num_points)));
-    const size_t num_buckets = static_cast<size_t>(
-        1U << barretenberg::scalar_multiplication::get_optimal_bucket_width(static_cast<size_t>(num_initial_points)));
-#ifndef NO_MULTITHREADING
-    const size_t num_threads = max_threads::compute_num_threads();
-#else
-    const size_t num_threads = 1;
-#endif
-    const size_t prefetch_overflow = 16 * num_threads;
-    const size_t num_rounds =
-        static_cast<size_t>(barretenberg::scalar_multiplication::get_num_rounds(static_cast<size_t>(num_points_floor)));
-    point_schedule = (uint64_t*)(aligned_alloc(
-        64, (static_cast<size_t>(num_points) * num_rounds + prefetch_overflow) * sizeof(uint64_t)));
-    skew_table = (bool*)(aligned_alloc(64, pad(static_cast<size_t>(num_points) * sizeof(bool), 64)));
-    point_pairs_1 = (g1::affine_element*)(aligned_alloc(
-        64, (static_cast<size_t>(num_points) * 2 + (num_threads * 16)) * sizeof(g1::affine_element)));
-    point_pairs_2 = (g1::affine_element*)(aligned_alloc(
-        64, (static_cast<size_t>(num_points) * 2 + (num_threads * 16)) * sizeof(g1::affine_element)));
-    scratch_space = (fq*)(aligned_alloc(64, static_cast<size_t>(num_points) * sizeof(g1::affine_element)));
-    bucket_counts = (uint32_t*)(aligned_alloc(64, num_threads * num_buckets * sizeof(uint32_t)));
-    bit_counts = (uint32_t*)(aligned_alloc(64, num_threads * num_buckets * sizeof(uint32_t)));
-    bucket_empty_status = (bool*)(aligned_alloc(64, num_threads * num_buckets * sizeof(bool)));
-    round_counts = (uint64_t*)(aligned_alloc(32, MAX_NUM_ROUNDS * sizeof(uint64_t)));
+    const runtime_state_sizes sizes(num_initial_points);
+    num_points = sizes.num_points;
+    const size_t num_threads = sizes.num_threads;
+    const size_t num_rounds = sizes.num_rounds;
+    point_schedule = (uint64_t*)(aligned_alloc(64, sizes.point_schedule));
+    skew_table = (bool*)(aligned_alloc(64, sizes.skew_table));
+    point_pairs_1 = (g1::affine_element*)(aligned_alloc(64, sizes.point_pairs));
+    point_pairs_2 = (g1::affine_element*)(aligned_alloc(64, sizes.point_pairs));
+    scratch_space = (fq*)(aligned_alloc(64, sizes.scratch_space));
+    bucket_counts = (uint32_t*)(aligned_alloc(64, sizes.bucket_counts));
+    bit_counts = (uint32_t*)(aligned_alloc(64, sizes.bucket_counts));
+    bucket_empty_status = (bool*)(aligned_alloc(64, sizes.bucket_empty_status));
+    round_counts = (uint64_t*)(aligned_alloc(32, sizes.round_counts));
 
     const size_t points_per_thread = static_cast<size_t>(num_points) / num_threads;
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < num_threads; ++i) {
+    parallel_for(num_threads, [&](size_t i) {
         const size_t thread_offset = i * points_per_thread;
         memset((void*)(point_pairs_1 + thread_offset + (i * 16)),
                0,
@@ -57,12 +84,33 @@ pippenger_runtime_state::pippenger_runtime_state(const size_t num_initial_points
             memset((void*)(point_schedule + round_offset + thread_offset), 0, points_per_thread * sizeof(uint64_t));
         }
         memset((void*)(skew_table + thread_offset), 0, points_per_thread * sizeof(bool));
-    }
+    });
+
+    memset((void*)bucket_counts, 0, sizes.bucket_counts);
+    memset((void*)bit_counts, 0, sizes.bucket_counts);
+    memset((void*)bucket_empty_status, 0, sizes.bucket_empty_status);
+    memset((void*)round_counts, 0, sizes.round_counts);
+}
 
-    memset((void*)bucket_counts, 0, num_threads * num_buckets * sizeof(uint32_t));
-    memset((void*)bit_counts, 0, num_threads * num_buckets * sizeof(uint32_t));
-    memset((void*)bucket_empty_status, 0, num_threads * num_buckets * sizeof(bool));
-    memset((void*)round_counts, 0, MAX_NUM_ROUNDS * sizeof(uint64_t));
+pippenger_runtime_state::pippenger_runtime_state(const size_t num_initial_points, const size_t max_memory)
+    : pippenger_runtime_state(get_max_num_initial_points(num_initial_points, max_memory))
+{}
+
+size_t pippenger_runtime_state::get_memory_size(const size_t num_initial_points)
+{
+    return runtime_state_sizes(num_initial_points).total();
+}
+
+size_t pippenger_runtime_state::get_max_num_initial_points(const size_t num_initial_points, const size_t max_memory)
+{
+    if (num_initial_points <= MIN_CHUNK_POINTS || get_memory_size(num_initial_points) <= max_memory) {
+        return num_initial_points;
+    }
+    size_t chunk_points = static_cast<size_t>(1ULL << numeric::get_msb(num_initial_points));
+    while (chunk_points > MIN_CHUNK_POINTS && get_memory_size(chunk_points) > max_memory) {
+        chunk_points >>= 1;
+    }
+    return chunk_points;
 }
 
 pippenger_runtime_state::pippenger_runtime_state(pippenger_runtime_state&& other)
@@ -88,11 +88,25 @@ struct pippenger_runtime_state {
     uint64_t num_points;
 
     pippenger_runtime_state(const size_t num_initial_points);
+    /**
+     * A state for multi-scalar multiplications of up to num_initial_points points, allocating at most max_memory
+     * bytes. If the full size doesn't fit, the state holds the largest power of two of points that does (never fewer
+     * than MIN_CHUNK_POINTS) and pippenger() runs bigger inputs in chunks of that size.
+     */
+    pippenger_runtime_state(const size_t num_initial_points, const size_t max_memory);
     pippenger_runtime_state(pippenger_runtime_state&& other);
     pippenger_runtime_state& operator=(pippenger_runtime_state&& other);
     ~pippenger_runtime_state();
 
     affine_product_runtime_state get_affine_product_runtime_state(const size_t num_threads, const size_t thread_index);
+
+    // Number of points (before the endomorphism split) the state can process in one go
+    size_t get_max_num_initial_points() const { return static_cast<size_t>(num_points / 2); }
+
+    static constexpr size_t MIN_CHUNK_POINTS = 1UL << 12;
+    // Bytes allocated by a state constructed for num_initial_points
+    static size_t get_memory_size(const size_t num_initial_points);
+    static size_t get_max_num_initial_points(const size_t num_initial_points, const size_t max_memory);
 };
 } // namespace scalar_multiplication
 } // namespace barretenberg
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 
 #include <array>
@@ -17,9 +18,6 @@
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
 
-#ifndef NO_MULTITHREADING
-#include <omp.h>
-#endif
 
 #define BBERG_SCALAR_MULTIPLICATION_FETCH_BLOCK                                                                        \
     __builtin_prefetch(state.points + (state.point_schedule[schedule_it + 16] >> 32ULL));                              \
@@ -204,11 +202,7 @@ void compute_wnaf_states(uint64_t* point_schedule,
     const size_t num_rounds = get_num_rounds(num_points);
     const size_t bits_per_bucket = get_optimal_bucket_width(num_initial_points);
     const size_t wnaf_bits = bits_per_bucket + 1;
-#ifndef NO_MULTITHREADING
     const size_t num_threads = max_threads::compute_num_threads();
-#else
-    const size_t num_threads = 1;
-#endif
     const size_t num_initial_points_per_thread = num_initial_points / num_threads;
     const size_t num_points_per_thread = num_points / num_threads;
     std::array<std::array<uint64_t, MAX_NUM_ROUNDS>, MAX_NUM_THREADS> thread_round_counts;
@@ -217,10 +211,7 @@ void compute_wnaf_states(uint64_t* point_schedule,
             thread_round_counts[i][j] = 0;
         }
     }
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < num_threads; ++i) {
+    parallel_for(num_threads, [&](size_t i) {
         fr T0;
         uint64_t* wnaf_table = &point_schedule[(2 * i) * num_initial_points_per_thread];
         const fr* thread_scalars = &scalars[i * num_initial_points_per_thread];
@@ -246,7 +237,7 @@ void compute_wnaf_states(uint64_t* point_schedule,
                                          num_points,
                                          wnaf_bits);
         }
-    }
+    });
 
     for (size_t i = 0; i < num_rounds; ++i) {
         round_counts[i] = 0;
@@ -266,15 +257,18 @@ void compute_wnaf_states(uint64_t* point_schedule,
  **/
 void organize_buckets(uint64_t* point_schedule, const uint64_t*, const size_t num_points)
 {
-    const size_t num_rounds = get_num_rounds(num_points);
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < num_rounds; ++i) {
-        scalar_multiplication::process_buckets(&point_schedule[i * num_points],
-                                               num_points,
-                                               static_cast<uint32_t>(get_optimal_bucket_width(num_points / 2)) + 1);
-    }
+    organize_buckets(point_schedule, num_points, get_num_rounds(num_points), get_optimal_bucket_width(num_points / 2));
+}
+
+void organize_buckets(uint64_t* point_schedule,
+                      const size_t num_points,
+                      const size_t num_rounds,
+                      const size_t bits_per_bucket)
+{
+    parallel_for(num_rounds, [&](size_t i) {
+        scalar_multiplication::process_buckets(
+            &point_schedule[i * num_points], num_points, static_cast<uint32_t>(bits_per_bucket) + 1);
+    });
 }
 
 /**
@@ -728,21 +722,27 @@ g1::element evaluate_pippenger_rounds(pippenger_runtime_state& state,
                                       const size_t num_points,
                                       bool handle_edge_cases)
 {
-    const size_t num_rounds = get_num_rounds(num_points);
-#ifndef NO_MULTITHREADING
+    return evaluate_pippenger_rounds(state,
+                                     points,
+                                     num_points,
+                                     get_num_rounds(num_points),
+                                     get_optimal_bucket_width(num_points / 2),
+                                     handle_edge_cases);
+}
+
+g1::element evaluate_pippenger_rounds(pippenger_runtime_state& state,
+                                      g1::affine_element* points,
+                                      const size_t num_points,
+                                      const size_t num_rounds,
+                                      const size_t bits_per_bucket,
+                                      bool handle_edge_cases)
+{
     const size_t num_threads = max_threads::compute_num_threads();
-#else
-    const size_t num_threads = 1;
-#endif
-    const size_t bits_per_bucket = get_optimal_bucket_width(num_points / 2);
 
     std::unique_ptr<g1::element[], decltype(&aligned_free)> thread_accumulators(
         static_cast<g1::element*>(aligned_alloc(64, num_threads * sizeof(g1::element))), &aligned_free);
 
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t j = 0; j < num_threads; ++j) {
+    parallel_for(num_threads, [&](size_t j) {
         thread_accumulators[j].self_set_infinity();
 
         for (size_t i = 0; i < num_rounds; ++i) {
@@ -833,7 +833,7 @@ g1::element evaluate_pippenger_rounds(pippenger_runtime_state& state,
             }
             thread_accumulators[j] += accumulator;
         }
-    }
+    });
 
     g1::element result;
     result.self_set_infinity();
@@ -865,11 +865,7 @@ g1::element pippenger(fr* scalars,
     // our windowed non-adjacent form algorthm requires that each thread can work on at least 8 points.
     // If we fall below this theshold, fall back to the traditional scalar multiplication algorithm.
     // For 8 threads, this neatly coincides with the threshold where Strauss scalar multiplication outperforms Pippenger
-#ifndef NO_MULTITHREADING
     const size_t threshold = std::max(max_threads::compute_num_threads() * 8, 8UL);
-#else
-    const size_t threshold = 8UL;
-#endif
 
     if (num_initial_points == 0) {
         g1::element out = g1::one;
@@ -881,12 +877,9 @@ g1::element pippenger(fr* scalars,
         std::vector<g1::element> exponentiation_results(num_initial_points);
         // might as well multithread this...
         // Possible optimization: use group::batch_mul_with_endomorphism here.
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-        for (size_t i = 0; i < num_initial_points; ++i) {
+        parallel_for(num_initial_points, [&](size_t i) {
             exponentiation_results[i] = g1::element(points[i * 2]) * scalars[i];
-        }
+        });
 
         for (size_t i = num_initial_points - 1; i > 0; --i) {
             exponentiation_results[i - 1] += exponentiation_results[i];
@@ -894,6 +887,23 @@ g1::element pippenger(fr* scalars,
         return exponentiation_results[0];
     }
 
+    // Inputs bigger than the runtime state run in chunks of the largest power of two it can hold. Each chunk is a
+    // complete multi-exponentiation (with the bucket width that suits the chunk size) accumulated into the result.
+    const size_t max_chunk_points = state.get_max_num_initial_points();
+    if (num_initial_points > max_chunk_points) {
+        const size_t chunk_points = static_cast<size_t>(1ULL << numeric::get_msb(std::max(max_chunk_points, 1UL)));
+        g1::element result;
+        result.self_set_infinity();
+        for (size_t offset = 0; offset < num_initial_points; offset += chunk_points) {
+            result += pippenger(scalars + offset,
+                                points + offset * 2,
+                                std::min(chunk_points, num_initial_points - offset),
+                                state,
+                                handle_edge_cases);
+        }
+        return result;
+    }
+
     const size_t slice_bits = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_initial_points)));
     const size_t num_slice_points = static_cast<size_t>(1ULL << slice_bits);
 
@@ -95,6 +95,12 @@ void generate_pippenger_point_table(g1::affine_element* points, g1::affine_eleme
 
 void organize_buckets(uint64_t* point_schedule, const uint64_t* round_counts, const size_t num_points);
 
+// As above, for a schedule of `num_rounds` rounds of `num_points` entries whose buckets are `bits_per_bucket` wide
+void organize_buckets(uint64_t* point_schedule,
+                      const size_t num_points,
+                      const size_t num_rounds,
+                      const size_t bits_per_bucket);
+
 inline void count_bits(uint32_t* bucket_counts,
                        uint32_t* bit_offsets,
                        const uint32_t num_buckets,
@@ -132,6 +138,18 @@ g1::element evaluate_pippenger_rounds(pippenger_runtime_state& state,
                                       const size_t num_points,
                                       bool handle_edge_cases = false);
 
+/**
+ * Evaluates a point schedule with an explicit round count and bucket width, rather than the ones pippenger picks for
+ * `num_points`. Rounds are separated by (bits_per_bucket + 1) doublings, and `state.skew_table` is read for
+ * `points[0..num_points)`. The state's bucket arrays must hold 2^bits_per_bucket buckets.
+ */
+g1::element evaluate_pippenger_rounds(pippenger_runtime_state& state,
+                                      g1::affine_element* points,
+                                      const size_t num_points,
+                                      const size_t num_rounds,
+                                      const size_t bits_per_bucket,
+                                      bool handle_edge_cases);
+
 g1::affine_element* reduce_buckets(affine_product_runtime_state& state,
                                    bool first_round = true,
                                    bool handle_edge_cases = false);
@@ -1,3 +1,4 @@
+#include "fixed_base_point_table.hpp"
 #include "pippenger.hpp"
 #include "scalar_multiplication.hpp"
 #include <chrono>
@@ -695,6 +696,41 @@ TEST(scalar_multiplication, pippenger)
     EXPECT_EQ(result == expected, true);
 }
 
+TEST(scalar_multiplication, pippenger_bounded_memory)
+{
+    // a runtime state capped below the input size processes the input in chunks
+    constexpr size_t chunk_points = pippenger_runtime_state::MIN_CHUNK_POINTS;
+    constexpr size_t num_points = 3 * chunk_points + 100;
+
+    fr* scalars = (fr*)aligned_alloc(32, sizeof(fr) * num_points);
+
+    g1::affine_element* points =
+        (g1::affine_element*)aligned_alloc(32, sizeof(g1::affine_element) * num_points * 2 + 1);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = fr::random_element();
+        points[i] = g1::affine_element(g1::element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+
+    scalar_multiplication::pippenger_runtime_state state(num_points);
+    g1::element expected = scalar_multiplication::pippenger(scalars, points, num_points, state);
+    expected = expected.normalize();
+
+    const size_t max_memory = pippenger_runtime_state::get_memory_size(chunk_points);
+    EXPECT_LT(max_memory, pippenger_runtime_state::get_memory_size(num_points));
+    scalar_multiplication::pippenger_runtime_state bounded_state(num_points, max_memory);
+    EXPECT_EQ(bounded_state.get_max_num_initial_points(), chunk_points);
+
+    g1::element result = scalar_multiplication::pippenger(scalars, points, num_points, bounded_state);
+    result = result.normalize();
+
+    aligned_free(scalars);
+    aligned_free(points);
+
+    EXPECT_EQ(result == expected, true);
+}
+
 TEST(scalar_multiplication, pippenger_edge_case_dbl)
 {
     constexpr size_t num_points = 128;
@@ -815,6 +851,50 @@ TEST(scalar_multiplication, pippenger_unsafe)
     EXPECT_EQ(result == expected, true);
 }
 
+TEST(scalar_multiplication, fixed_base_point_table)
+{
+    constexpr size_t num_points = 4096;
+    // not a power of two: one pass over the copies, and regular pippenger for the rest
+    constexpr size_t num_prefix_points = num_points - 100;
+
+    fr* scalars = (fr*)aligned_alloc(32, sizeof(fr) * num_points);
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = fr::random_element();
+        points[i] = g1::affine_element(g1::element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+
+    scalar_multiplication::pippenger_runtime_state state(num_points);
+    g1::element expected = scalar_multiplication::pippenger_unsafe(scalars, points, num_points, state).normalize();
+    g1::element expected_prefix =
+        scalar_multiplication::pippenger_unsafe(scalars, points, num_prefix_points, state).normalize();
+
+    for (const size_t num_copies : { 1UL, 3UL, 4UL, 16UL }) {
+        scalar_multiplication::FixedBasePointTable table(points, num_points, num_copies);
+        const size_t num_windows = WNAF_SIZE(table.get_bits_per_bucket() + 1);
+        EXPECT_EQ(table.get_num_rounds(), (num_windows + num_copies - 1) / num_copies);
+
+        scalar_multiplication::pippenger_runtime_state fixed_base_state(table.get_runtime_state_size());
+        EXPECT_TRUE(table.can_multiply(num_points, fixed_base_state));
+        EXPECT_TRUE(table.can_multiply(num_prefix_points, fixed_base_state));
+        EXPECT_FALSE(table.can_multiply(num_points / 2, fixed_base_state));
+
+        g1::element result = table.pippenger_unsafe(scalars, num_points, fixed_base_state).normalize();
+        EXPECT_EQ(result, expected);
+        result = table.pippenger_unsafe(scalars, num_prefix_points, fixed_base_state).normalize();
+        EXPECT_EQ(result, expected_prefix);
+
+        // a state sized for regular pippenger falls back to it
+        result = table.pippenger_unsafe(scalars, num_points, state).normalize();
+        EXPECT_EQ(result, expected);
+    }
+
+    aligned_free(scalars);
+    aligned_free(points);
+}
+
 TEST(scalar_multiplication, pippenger_unsafe_short_inputs)
 {
     constexpr size_t num_points = 8192;
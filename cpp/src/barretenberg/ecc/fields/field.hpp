@@ -201,6 +201,9 @@ template <class Params> struct alignas(32) field {
 
     BBERG_INLINE constexpr field sqr() const noexcept;
     BBERG_INLINE constexpr void self_sqr() noexcept;
+    // The SIMD128 multiplication kernel. Not used by operator* until it is measured to beat montgomery_mul in wasm;
+    // fr.bench compares the two
+    BBERG_INLINE field montgomery_mul_simd(const field& other) const noexcept;
 
     BBERG_INLINE constexpr field pow(const uint256_t& exponent) const noexcept;
     BBERG_INLINE constexpr field pow(const uint64_t exponent) const noexcept;
@@ -110,7 +110,7 @@ template <class base_field, class Params> struct alignas(32) field2 {
         base_field::serialize_to_buffer(value.c1, buffer + sizeof(base_field));
     }
 
-    static field2 serialize_from_buffer(uint8_t* buffer)
+    static field2 serialize_from_buffer(const uint8_t* buffer)
     {
         field2 result{ base_field::zero(), base_field::zero() };
         result.c0 = base_field::serialize_from_buffer(buffer);
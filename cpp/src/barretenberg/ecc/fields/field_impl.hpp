@@ -11,6 +11,8 @@
 #include "field_impl_x64.hpp"
 #endif
 
+#include "field_impl_wasm_simd.hpp"
+
 #include "field_impl_generic.hpp"
 namespace barretenberg {
 
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <array>
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+#endif
+
+namespace barretenberg {
+namespace wasm_simd {
+
+/**
+ * Written with vector extensions so the kernel is compiled and tested in native builds too. Only the widening multiply needs an intrinsic to be sure of getting
+ * i64x2.extmul_low_i32x4_u (a plain i64x2.mul is several instructions on most hosts).
+ */
+using u64x2 = uint64_t __attribute__((vector_size(16)));
+using u32x4 = uint32_t __attribute__((vector_size(16)));
+
+/**
+ * @brief The two 64-bit products of the low two 32-bit lanes of a and b.
+ */
+BBERG_INLINE u64x2 mul_extended(const u32x4 a, const u32x4 b) noexcept
+{
+#ifdef __wasm_simd128__
+    return reinterpret_cast<u64x2>(
+        wasm_u64x2_extmul_low_u32x4(reinterpret_cast<v128_t>(a), reinterpret_cast<v128_t>(b)));
+#else
+    return u64x2{ a[0], a[1] } * u64x2{ b[0], b[1] };
+#endif
+}
+
+// 9 x 29-bit limbs cover 261 bits. A product of two limbs is < 2^58, so a 64-bit lane can absorb the 18 products a
+// column receives over the whole multiplication without any carry handling.
+constexpr uint64_t LIMB_BITS = 29;
+constexpr uint64_t LIMB_MASK = (1ULL << LIMB_BITS) - 1;
+constexpr size_t NUM_LIMBS = 9;
+constexpr size_t NUM_VECTORS = (NUM_LIMBS + 1) / 2;
+
+/**
+ * @brief Bits [offset, offset + 29) of a 256-bit integer. Bits below 0 and above 255 read as zero.
+ */
+constexpr uint64_t extract_limb(const uint64_t* data, const int offset) noexcept
+{
+    if (offset < 0) {
+        return (data[0] << static_cast<uint64_t>(-offset)) & LIMB_MASK;
+    }
+    const auto word = static_cast<size_t>(offset) / 64;
+    const auto shift = static_cast<uint64_t>(offset) % 64;
+    if (word >= 4) {
+        return 0;
+    }
+    uint64_t limb = data[word] >> shift;
+    if (shift > 64 - LIMB_BITS && word + 1 < 4) {
+        limb |= data[word + 1] << (64 - shift);
+    }
+    return limb & LIMB_MASK;
+}
+
+/**
+ * @brief Limbs of a 256-bit integer laid out for even rounds (limb j in lane j) and odd rounds (limb j in lane j + 1).
+ */
+constexpr std::array<std::array<uint64_t, 2 * NUM_VECTORS + 2>, 2> split_limbs(const uint64_t* data) noexcept
+{
+    std::array<std::array<uint64_t, 2 * NUM_VECTORS + 2>, 2> limbs{};
+    for (size_t j = 0; j < NUM_LIMBS; ++j) {
+        limbs[0][j] = extract_limb(data, static_cast<int>(j * LIMB_BITS));
+        limbs[1][j + 1] = limbs[0][j];
+    }
+    return limbs;
+}
+
+} // namespace wasm_simd
+
+/**
+ * @brief Montgomery multiplication over 29-bit limbs, two limb products per SIMD128 instruction
+ *
+ * @details The 32-bit-limb path in montgomery_mul has to propagate a carry after every limb product, which serialises
+ * it. Here every column accumulates lazily in a 64-bit lane, and the only carry handled per round is the one out of the
+ * column being reduced (it has to be exact before the next Montgomery factor is derived from it).
+ *
+ * Round i adds a[i] * b and k * p into columns i..i+9. Columns are stored in pairs, so the operands are kept in two
+ * alignments and odd rounds use the one shifted by a lane; no lane shuffles are needed.
+ *
+ * Nine limbs make the Montgomery radix 2^261 rather than 2^256, so `this` is scaled by 2^5 while splitting it into limbs
+ * (32 * this < 64p < 2^261 still fits). The result is a * b * 2^-256 mod p, in [0, 2p) like montgomery_mul.
+ */
+template <class T> field<T> field<T>::montgomery_mul_simd(const field& other) const noexcept
+{
+    using namespace wasm_simd;
+    static constexpr auto p_limbs = split_limbs(&modulus.data[0]);
+    static constexpr uint64_t r_inv = T::r_inv & LIMB_MASK;
+
+    uint32_t a[NUM_LIMBS];
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        a[i] = static_cast<uint32_t>(extract_limb(&data[0], static_cast<int>(i * LIMB_BITS) - 5));
+    }
+    uint32_t b[NUM_LIMBS];
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        b[i] = static_cast<uint32_t>(extract_limb(&other.data[0], static_cast<int>(i * LIMB_BITS)));
+    }
+
+    // Even rounds pair up limbs (2v, 2v + 1), odd rounds limbs (2v - 1, 2v). The modulus vectors are constants
+    u32x4 b_vec[2][NUM_VECTORS];
+    u32x4 p_vec[2][NUM_VECTORS];
+    for (size_t v = 0; v < NUM_VECTORS; ++v) {
+        b_vec[0][v] = u32x4{ b[2 * v], 2 * v + 1 < NUM_LIMBS ? b[2 * v + 1] : 0, 0, 0 };
+        b_vec[1][v] = u32x4{ v > 0 ? b[2 * v - 1] : 0, b[2 * v], 0, 0 };
+        for (size_t parity = 0; parity < 2; ++parity) {
+            p_vec[parity][v] = u32x4{ static_cast<uint32_t>(p_limbs[parity][2 * v]),
+                                      static_cast<uint32_t>(p_limbs[parity][2 * v + 1]),
+                                      0,
+                                      0 };
+        }
+    }
+
+    // Column c lives in t[c / 2][c % 2]
+    u64x2 t[NUM_LIMBS]{};
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        const size_t parity = i & 1;
+        const size_t base = i >> 1;
+        const u32x4 a_i{ a[i], a[i], 0, 0 };
+        for (size_t v = 0; v < NUM_VECTORS; ++v) {
+            t[base + v] += mul_extended(a_i, b_vec[parity][v]);
+        }
+        const auto k = static_cast<uint32_t>((t[base][parity] * r_inv) & LIMB_MASK);
+        const u32x4 k_i{ k, k, 0, 0 };
+        for (size_t v = 0; v < NUM_VECTORS; ++v) {
+            t[base + v] += mul_extended(k_i, p_vec[parity][v]);
+        }
+        // Column i is now a multiple of 2^29; move its high part into column i + 1
+        t[(i + 1) >> 1][(i + 1) & 1] += t[base][parity] >> LIMB_BITS;
+    }
+
+    // The result is in columns 9..17. Normalise to 29-bit limbs and repack into 64-bit words
+    field result{ 0, 0, 0, 0 };
+    uint64_t carry = 0;
+    for (size_t j = 0; j < NUM_LIMBS; ++j) {
+        const size_t column = NUM_LIMBS + j;
+        const uint64_t sum = t[column >> 1][column & 1] + carry;
+        const uint64_t limb = sum & LIMB_MASK;
+        carry = sum >> LIMB_BITS;
+
+        const size_t bit = j * LIMB_BITS;
+        const size_t word = bit / 64;
+        const uint64_t shift = bit % 64;
+        result.data[word] |= limb << shift;
+        if (shift > 64 - LIMB_BITS && word + 1 < 4) {
+            result.data[word + 1] |= limb >> (64 - shift);
+        }
+    }
+    return result;
+}
+
+} // namespace barretenberg
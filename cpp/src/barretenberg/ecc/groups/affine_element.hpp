@@ -121,7 +121,7 @@ template <typename Fq, typename Fr, typename Params> class alignas(64) affine_el
      *
      * @warning This will need to be updated if we serialize points over composite-order fields other than fq2!
      */
-    static affine_element serialize_from_buffer(uint8_t* buffer)
+    static affine_element serialize_from_buffer(const uint8_t* buffer)
     {
         affine_element result;
 
@@ -0,0 +1,7 @@
+#pragma once
+#include <stdint.h>
+
+// To be provided by the environment.
+// For a WASM build, this is provided by the JavaScript environment (the number of workers it is willing to spawn).
+// For a native build, this is provided in this module.
+extern "C" uint32_t env_hardware_concurrency();
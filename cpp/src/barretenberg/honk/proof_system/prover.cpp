@@ -233,51 +233,67 @@ template <StandardFlavor Flavor> plonk::proof& StandardProver_<Flavor>::export_p
 }
 
 template <StandardFlavor Flavor> plonk::proof& StandardProver_<Flavor>::construct_proof()
+{
+    return construct_proof([](std::string_view) {});
+}
+
+template <StandardFlavor Flavor>
+plonk::proof& StandardProver_<Flavor>::construct_proof(const RoundCallback& round_completed)
 {
     // Add circuit size and public input size to transcript.
     execute_preamble_round();
+    round_completed("preamble");
 
     // Compute wire commitments; Add PI to transcript
     execute_wire_commitments_round();
     queue.process_queue();
+    round_completed("wire_commitments");
 
     // Currently a no-op; may execute some "random widgets", commit to W_4, do RAM/ROM stuff
     // if this prover structure is kept when we bring tables to Honk.
     // Suggestion: Maybe we shouldn't mix and match proof creation for different systems and
     // instead instatiate construct_proof differently for each?
     execute_tables_round();
+    round_completed("tables");
 
     // Fiat-Shamir: beta & gamma
     // Compute grand product(s) and commitments.
     execute_grand_product_computation_round();
     queue.process_queue();
+    round_completed("grand_product");
 
     // Fiat-Shamir: alpha
     // Run sumcheck subprotocol.
     execute_relation_check_rounds();
+    round_completed("sumcheck");
 
     // Fiat-Shamir: rho
     // Compute Fold polynomials and their commitments.
     execute_univariatization_round();
     queue.process_queue();
+    round_completed("univariatization");
 
     // Fiat-Shamir: r
     // Compute Fold evaluations
     execute_pcs_evaluation_round();
+    round_completed("pcs_evaluation");
 
     // Fiat-Shamir: nu
     // Compute Shplonk batched quotient commitment Q
     execute_shplonk_batched_quotient_round();
     queue.process_queue();
+    round_completed("shplonk_batched_quotient");
 
     // Fiat-Shamir: z
     // Compute partial evaluation Q_z
     execute_shplonk_partial_evaluation_round();
+    round_completed("shplonk_partial_evaluation");
 
     // Fiat-Shamir: z
     // Compute KZG quotient commitment
     execute_kzg_round();
     queue.process_queue();
+    round_completed("kzg");
 
     return export_proof();
 }
@@ -10,6 +10,8 @@
 #include "barretenberg/honk/proof_system/prover_library.hpp"
 #include "barretenberg/honk/proof_system/work_queue.hpp"
 #include "barretenberg/honk/flavor/standard.hpp"
+#include <functional>
+#include <string_view>
 
 namespace proof_system::honk {
 
@@ -27,6 +29,9 @@ template <StandardFlavor Flavor> class StandardProver_ {
     using CommitmentLabels = typename Flavor::CommitmentLabels;
 
   public:
+    // Called with the name of each round of construct_proof() once it (and the work it queued) is done
+    using RoundCallback = std::function<void(std::string_view round)>;
+
     explicit StandardProver_(std::shared_ptr<ProvingKey> input_key = nullptr);
 
     void execute_preamble_round();
@@ -46,6 +51,7 @@ template <StandardFlavor Flavor> class StandardProver_ {
 
     plonk::proof& export_proof();
     plonk::proof& construct_proof();
+    plonk::proof& construct_proof(const RoundCallback& round_completed);
 
     ProverTranscript<FF> transcript;
 
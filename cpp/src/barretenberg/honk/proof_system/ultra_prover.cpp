@@ -289,49 +289,65 @@ template <UltraFlavor Flavor> plonk::proof& UltraProver_<Flavor>::export_proof()
 }
 
 template <UltraFlavor Flavor> plonk::proof& UltraProver_<Flavor>::construct_proof()
+{
+    return construct_proof([](std::string_view) {});
+}
+
+template <UltraFlavor Flavor>
+plonk::proof& UltraProver_<Flavor>::construct_proof(const RoundCallback& round_completed)
 {
     // Add circuit size public input size and public inputs to transcript.
     execute_preamble_round();
+    round_completed("preamble");
 
     // Compute first three wire commitments
     execute_wire_commitments_round();
     queue.process_queue();
+    round_completed("wire_commitments");
 
     // Compute sorted list accumulator and commitment
     execute_sorted_list_accumulator_round();
     queue.process_queue();
+    round_completed("sorted_list_accumulator");
 
     // Fiat-Shamir: beta & gamma
     // Compute grand product(s) and commitments.
     execute_grand_product_computation_round();
     queue.process_queue();
+    round_completed("grand_product");
 
     // Fiat-Shamir: alpha
     // Run sumcheck subprotocol.
     execute_relation_check_rounds();
+    round_completed("sumcheck");
 
     // Fiat-Shamir: rho
     // Compute Fold polynomials and their commitments.
     execute_univariatization_round();
     queue.process_queue();
+    round_completed("univariatization");
 
     // Fiat-Shamir: r
     // Compute Fold evaluations
     execute_pcs_evaluation_round();
+    round_completed("pcs_evaluation");
 
     // Fiat-Shamir: nu
     // Compute Shplonk batched quotient commitment Q
     execute_shplonk_batched_quotient_round();
     queue.process_queue();
+    round_completed("shplonk_batched_quotient");
 
     // Fiat-Shamir: z
     // Compute partial evaluation Q_z
     execute_shplonk_partial_evaluation_round();
+    round_completed("shplonk_partial_evaluation");
 
     // Fiat-Shamir: z
     // Compute KZG quotient commitment
     execute_kzg_round();
     queue.process_queue();
+    round_completed("kzg");
 
     return export_proof();
 }
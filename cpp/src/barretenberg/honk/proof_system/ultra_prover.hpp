@@ -8,6 +8,8 @@
 #include "barretenberg/honk/flavor/ultra.hpp"
 #include "barretenberg/honk/sumcheck/relations/relation_parameters.hpp"
 #include "barretenberg/honk/sumcheck/sumcheck_output.hpp"
+#include <functional>
+#include <string_view>
 
 namespace proof_system::honk {
 
@@ -24,6 +26,9 @@ template <UltraFlavor Flavor> class UltraProver_ {
     using CommitmentLabels = typename Flavor::CommitmentLabels;
 
   public:
+    // Called with the name of each round of construct_proof() once it (and the work it queued) is done
+    using RoundCallback = std::function<void(std::string_view round)>;
+
     explicit UltraProver_(std::shared_ptr<ProvingKey> input_key = nullptr);
 
     void execute_preamble_round();
@@ -41,6 +46,7 @@ template <UltraFlavor Flavor> class UltraProver_ {
 
     plonk::proof& export_proof();
     plonk::proof& construct_proof();
+    plonk::proof& construct_proof(const RoundCallback& round_completed);
 
     ProverTranscript<FF> transcript;
 
@@ -103,10 +103,8 @@ template <class Fr, size_t domain_size, size_t num_evals> class BarycentricData
      *      - B(x) = Π_{i=0}^{t-1} (x-x_i)
      *      - d_i  = Π_{j ∈ {0, ..., t-1}, j≠i} (x_i-x_j) for i ∈ {0, ..., t-1}
      *
-     * NOTE: just taking x_i = i for now and possibly forever. Hence can significantly optimize:
-     *       extending an Edge f = v0(1-X) + v1X to a new value involves just one addition and a subtraction:
-     *       setting Δ  = v1-v0, the values of f(X) are
-     *       f(0)=v0, f(1)= v0 + Δ, v2 = f(1) + Δ, v3 = f(2) + Δ...
+     * NOTE: just taking x_i = i for now and possibly forever. Hence when t = 2 (extending an edge), we use
+     *       extend_edge, which only needs additions.
      *
      */
     Univariate<Fr, num_evals> extend(Univariate<Fr, domain_size> f)
@@ -114,6 +112,11 @@ template <class Fr, size_t domain_size, size_t num_evals> class BarycentricData
         // ASSERT(u>t);
         Univariate<Fr, num_evals> result;
 
+        if constexpr (domain_size == 2) {
+            extend_edge(f.value_at(0), f.value_at(1), result);
+            return result;
+        }
+
         for (size_t k = 0; k != domain_size; ++k) {
             result.value_at(k) = f.value_at(k);
         }
@@ -132,6 +135,23 @@ template <class Fr, size_t domain_size, size_t num_evals> class BarycentricData
         return result;
     }
 
+    /**
+     * @brief Given the values v0 = f(0), v1 = f(1) of a linear f, write {f(0), ..., f(u-1)} into `result`.
+     *
+     * @details Setting Δ = v1 - v0, the values are f(0) = v0, f(1) = v0 + Δ, f(2) = f(1) + Δ, ..., so this takes a
+     * subtraction and u - 2 additions instead of the barycentric formula's multiplications. Writing into `result` lets
+     * sumcheck extend its edges in place.
+     */
+    static void extend_edge(const Fr& v0, const Fr& v1, Univariate<Fr, num_evals>& result)
+        requires(domain_size == 2)
+    {
+        const Fr delta = v1 - v0;
+        result.value_at(0) = v0;
+        for (size_t k = 1; k != num_evals; ++k) {
+            result.value_at(k) = result.value_at(k - 1) + delta;
+        }
+    }
+
     /**
      * @brief Evaluate a univariate at a point u not known at compile time
      * and assumed not to be in the domain (else we divide by zero).
@@ -80,9 +80,6 @@ template <typename Flavor> class SumcheckRound {
 
     ExtendedEdges<MAX_RELATION_LENGTH> extended_edges;
 
-    // TODO(#224)(Cody): this should go away
-    BarycentricData<FF, 2, MAX_RELATION_LENGTH> barycentric_2_to_max = BarycentricData<FF, 2, MAX_RELATION_LENGTH>();
-
     // Prover constructor
     SumcheckRound(size_t initial_round_size)
         : round_size(initial_round_size)
@@ -118,14 +115,15 @@ template <typename Flavor> class SumcheckRound {
      *
      * @details Should only be called externally with relation_idx equal to 0.
      * In practice, multivariates is one of ProverPolynomials or FoldedPolynomials.
+     * Edges are linear, so they are extended in place with additions only (see BarycentricData::extend_edge).
      *
      */
     void extend_edges(auto& multivariates, size_t edge_idx)
     {
         size_t univariate_idx = 0; // TODO(#391) zip
         for (auto& poly : multivariates) {
-            auto edge = Univariate<FF, 2>({ poly[edge_idx], poly[edge_idx + 1] });
-            extended_edges[univariate_idx] = barycentric_2_to_max.extend(edge);
+            BarycentricData<FF, 2, MAX_RELATION_LENGTH>::extend_edge(
+                poly[edge_idx], poly[edge_idx + 1], extended_edges[univariate_idx]);
             ++univariate_idx;
         }
     }
@@ -183,14 +183,14 @@ template <size_t program_width, bool with_tags> void ComposerBase::compute_sigma
         compute_permutation_lagrange_base_single<standard_settings>(
             sigma_polynomial_lagrange, sigma_mappings[i], key->small_domain);
 
-        // Compute permutation polynomial monomial form
+        // Compute permutation polynomial monomial and coset FFT forms
         barretenberg::polynomial sigma_polynomial(key->circuit_size);
-        barretenberg::polynomial_arithmetic::ifft(
-            &sigma_polynomial_lagrange[0], &sigma_polynomial[0], key->small_domain);
-
-        // Compute permutation polynomial coset FFT form
-        barretenberg::polynomial sigma_fft(sigma_polynomial, key->large_domain.size);
-        sigma_fft.coset_fft(key->large_domain);
+        barretenberg::polynomial sigma_fft(key->large_domain.size);
+        barretenberg::polynomial_arithmetic::coset_lde_from_lagrange(sigma_polynomial_lagrange.data(),
+                                                                     sigma_fft.data(),
+                                                                     sigma_polynomial.data(),
+                                                                     key->small_domain,
+                                                                     key->large_domain);
 
         key->polynomial_store.put("sigma_" + index + "_lagrange", std::move(sigma_polynomial_lagrange));
         key->polynomial_store.put("sigma_" + index, std::move(sigma_polynomial));
@@ -202,13 +202,14 @@ template <size_t program_width, bool with_tags> void ComposerBase::compute_sigma
             compute_permutation_lagrange_base_single<standard_settings>(
                 id_polynomial_lagrange, id_mappings[i], key->small_domain);
 
-            // Compute id polynomial monomial form
+            // Compute id polynomial monomial and coset FFT forms
             barretenberg::polynomial id_polynomial(key->circuit_size);
-            barretenberg::polynomial_arithmetic::ifft(&id_polynomial_lagrange[0], &id_polynomial[0], key->small_domain);
-
-            // Compute id polynomial coset FFT form
-            barretenberg::polynomial id_fft(id_polynomial, key->large_domain.size);
-            id_fft.coset_fft(key->large_domain);
+            barretenberg::polynomial id_fft(key->large_domain.size);
+            barretenberg::polynomial_arithmetic::coset_lde_from_lagrange(id_polynomial_lagrange.data(),
+                                                                         id_fft.data(),
+                                                                         id_polynomial.data(),
+                                                                         key->small_domain,
+                                                                         key->large_domain);
 
             key->polynomial_store.put("id_" + index + "_lagrange", std::move(id_polynomial_lagrange));
             key->polynomial_store.put("id_" + index, std::move(id_polynomial));
@@ -287,13 +288,15 @@ std::shared_ptr<proving_key> ComposerBase::compute_proving_key_base(const Compos
             selector_poly_lagrange[k] = selector_values[k - public_inputs.size()];
         }
 
-        // Compute monomial form of selector polynomial
+        // Compute monomial form and coset FFT of selector polynomial. One selector at a time, so that Lagrange forms
+        // the key does not keep are freed before the next selector is built
         polynomial selector_poly(subgroup_size);
-        polynomial_arithmetic::ifft(&selector_poly_lagrange[0], &selector_poly[0], circuit_proving_key->small_domain);
-
-        // Compute coset FFT of selector polynomial
-        polynomial selector_poly_fft(selector_poly, subgroup_size * 4 + 4);
-        selector_poly_fft.coset_fft(circuit_proving_key->large_domain);
+        polynomial selector_poly_fft(subgroup_size * 4 + 4);
+        polynomial_arithmetic::coset_lde_from_lagrange(selector_poly_lagrange.data(),
+                                                       selector_poly_fft.data(),
+                                                       selector_poly.data(),
+                                                       circuit_proving_key->small_domain,
+                                                       circuit_proving_key->large_domain);
 
         if (properties.requires_lagrange_base_polynomial) {
             circuit_proving_key->polynomial_store.put(properties.name + "_lagrange", std::move(selector_poly_lagrange));
@@ -19,22 +19,37 @@ namespace proof_system::plonk {
 void compute_monomial_and_coset_selector_forms(plonk::proving_key* circuit_proving_key,
                                                std::vector<SelectorProperties> selector_properties)
 {
-    for (size_t i = 0; i < selector_properties.size(); i++) {
-        // Compute monomial form of selector polynomial
+    const size_t num_selectors = selector_properties.size();
+
+    // Compute monomial and coset FFT forms of the selector polynomials from their lagrange form
+    std::vector<barretenberg::polynomial> selector_polys;
+    std::vector<barretenberg::polynomial> selector_poly_ffts;
+    std::vector<const barretenberg::fr*> selector_lagrange_coefficients;
+    std::vector<barretenberg::fr*> selector_coefficients;
+    std::vector<barretenberg::fr*> selector_fft_coefficients;
+    selector_polys.reserve(num_selectors);
+    selector_poly_ffts.reserve(num_selectors);
+    for (size_t i = 0; i < num_selectors; i++) {
         auto& selector_poly_lagrange =
             circuit_proving_key->polynomial_store.get(selector_properties[i].name + "_lagrange");
-        barretenberg::polynomial selector_poly(circuit_proving_key->circuit_size);
-        barretenberg::polynomial_arithmetic::ifft(
-            &selector_poly_lagrange[0], &selector_poly[0], circuit_proving_key->small_domain);
-
-        // Compute coset FFT of selector polynomial
-        barretenberg::polynomial selector_poly_fft(selector_poly, circuit_proving_key->circuit_size * 4 + 4);
-        selector_poly_fft.coset_fft(circuit_proving_key->large_domain);
+        selector_lagrange_coefficients.emplace_back(selector_poly_lagrange.data());
+        selector_polys.emplace_back(circuit_proving_key->circuit_size);
+        selector_coefficients.emplace_back(selector_polys.back().data());
+        selector_poly_ffts.emplace_back(circuit_proving_key->circuit_size * 4 + 4);
+        selector_fft_coefficients.emplace_back(selector_poly_ffts.back().data());
+    }
+    barretenberg::polynomial_arithmetic::coset_lde_from_lagrange<barretenberg::fr>(selector_lagrange_coefficients,
+                                                                                   selector_fft_coefficients,
+                                                                                   selector_coefficients,
+                                                                                   circuit_proving_key->small_domain,
+                                                                                   circuit_proving_key->large_domain);
 
+    for (size_t i = 0; i < num_selectors; i++) {
         // TODO(luke): For Standard/Turbo, the lagrange polynomials can be removed from the store at this point but this
         // is not the case for Ultra. Implement?
-        circuit_proving_key->polynomial_store.put(selector_properties[i].name, std::move(selector_poly));
-        circuit_proving_key->polynomial_store.put(selector_properties[i].name + "_fft", std::move(selector_poly_fft));
+        circuit_proving_key->polynomial_store.put(selector_properties[i].name, std::move(selector_polys[i]));
+        circuit_proving_key->polynomial_store.put(selector_properties[i].name + "_fft",
+                                                  std::move(selector_poly_ffts[i]));
     }
 }
 
@@ -369,16 +369,16 @@ std::shared_ptr<plonk::verification_key> UltraPlonkComposerHelper::compute_verif
 void UltraPlonkComposerHelper::add_table_column_selector_poly_to_proving_key(polynomial& selector_poly_lagrange_form,
                                                                              const std::string& tag)
 {
-    polynomial selector_poly_lagrange_form_copy(selector_poly_lagrange_form, circuit_proving_key->small_domain.size);
-
-    selector_poly_lagrange_form.ifft(circuit_proving_key->small_domain);
-    auto& selector_poly_coeff_form = selector_poly_lagrange_form;
-
-    polynomial selector_poly_coset_form(selector_poly_coeff_form, circuit_proving_key->circuit_size * 4);
-    selector_poly_coset_form.coset_fft(circuit_proving_key->large_domain);
+    polynomial selector_poly_coeff_form(circuit_proving_key->small_domain.size);
+    polynomial selector_poly_coset_form(circuit_proving_key->circuit_size * 4);
+    polynomial_arithmetic::coset_lde_from_lagrange(selector_poly_lagrange_form.data(),
+                                                   selector_poly_coset_form.data(),
+                                                   selector_poly_coeff_form.data(),
+                                                   circuit_proving_key->small_domain,
+                                                   circuit_proving_key->large_domain);
 
     circuit_proving_key->polynomial_store.put(tag, std::move(selector_poly_coeff_form));
-    circuit_proving_key->polynomial_store.put(tag + "_lagrange", std::move(selector_poly_lagrange_form_copy));
+    circuit_proving_key->polynomial_store.put(tag + "_lagrange", std::move(selector_poly_lagrange_form));
     circuit_proving_key->polynomial_store.put(tag + "_fft", std::move(selector_poly_coset_form));
 }
 
@@ -14,6 +14,7 @@
 #include "barretenberg/plonk/proof_system/commitment_scheme/kate_commitment_scheme.hpp"
 #include "barretenberg/srs/reference_string/file_reference_string.hpp"
 
+#include "barretenberg/proof_system/circuit_constructors/sort_memory_records.hpp"
 #include "barretenberg/proof_system/plookup_tables/types.hpp"
 #include "barretenberg/proof_system/plookup_tables/plookup_tables.hpp"
 #include "barretenberg/proof_system/plookup_tables/aes128.hpp"
@@ -489,16 +490,16 @@ uint32_t UltraComposer::put_constant_variable(const barretenberg::fr& variable)
 void UltraComposer::add_table_column_selector_poly_to_proving_key(polynomial& selector_poly_lagrange_form,
                                                                   const std::string& tag)
 {
-    polynomial selector_poly_lagrange_form_copy(selector_poly_lagrange_form, circuit_proving_key->small_domain.size);
-
-    selector_poly_lagrange_form.ifft(circuit_proving_key->small_domain);
-    auto& selector_poly_coeff_form = selector_poly_lagrange_form;
-
-    polynomial selector_poly_coset_form(selector_poly_coeff_form, circuit_proving_key->circuit_size * 4);
-    selector_poly_coset_form.coset_fft(circuit_proving_key->large_domain);
+    polynomial selector_poly_coeff_form(circuit_proving_key->small_domain.size);
+    polynomial selector_poly_coset_form(circuit_proving_key->circuit_size * 4);
+    polynomial_arithmetic::coset_lde_from_lagrange(selector_poly_lagrange_form.data(),
+                                                   selector_poly_coset_form.data(),
+                                                   selector_poly_coeff_form.data(),
+                                                   circuit_proving_key->small_domain,
+                                                   circuit_proving_key->large_domain);
 
     circuit_proving_key->polynomial_store.put(tag, std::move(selector_poly_coeff_form));
-    circuit_proving_key->polynomial_store.put(tag + "_lagrange", std::move(selector_poly_lagrange_form_copy));
+    circuit_proving_key->polynomial_store.put(tag + "_lagrange", std::move(selector_poly_lagrange_form));
     circuit_proving_key->polynomial_store.put(tag + "_fft", std::move(selector_poly_coset_form));
 }
 
@@ -2783,17 +2784,16 @@ void UltraComposer::process_ROM_array(const size_t rom_id, const size_t gate_off
     create_tag(sorted_list_tag, read_tag);
 
     // Make sure that every cell has been initialized
+    const size_t num_presorted = rom_array.records.size();
     for (size_t i = 0; i < rom_array.state.size(); ++i) {
         if (rom_array.state[i][0] == UNINITIALIZED_MEMORY_RECORD) {
             set_ROM_element_pair(rom_id, static_cast<uint32_t>(i), { zero_idx, zero_idx });
         }
     }
 
-#ifdef NO_TBB
-    std::sort(rom_array.records.begin(), rom_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, rom_array.records.begin(), rom_array.records.end());
-#endif
+    // The records added above for uninitialized cells are the only ones at their index, so they merge into the
+    // index order established by process_ROM_arrays
+    sort_memory_records(rom_array.records, rom_array.state.size(), num_presorted);
 
     for (const RomRecord& record : rom_array.records) {
         const auto index = record.index;
@@ -2867,17 +2867,16 @@ void UltraComposer::process_RAM_array(const size_t ram_id, const size_t gate_off
     // TODO: throw some kind of error here? Circuit should initialize all RAM elements to prevent errors.
     // e.g. if a RAM record is uninitialized but the index of that record is a function of public/private inputs,
     // different public iputs will produce different circuit constraints.
+    const size_t num_presorted = ram_array.records.size();
     for (size_t i = 0; i < ram_array.state.size(); ++i) {
         if (ram_array.state[i] == UNINITIALIZED_MEMORY_RECORD) {
             init_RAM_element(ram_id, static_cast<uint32_t>(i), zero_idx);
         }
     }
 
-#ifdef NO_TBB
-    std::sort(ram_array.records.begin(), ram_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, ram_array.records.begin(), ram_array.records.end());
-#endif
+    // The records added above for uninitialized cells are the only ones at their index, so they merge into the
+    // (index, timestamp) order established by process_RAM_arrays
+    sort_memory_records(ram_array.records, ram_array.state.size(), num_presorted);
 
     // Iterate over all but final RAM record.
     for (size_t i = 0; i < ram_array.records.size(); ++i) {
@@ -2993,12 +2992,28 @@ void UltraComposer::process_RAM_array(const size_t ram_id, const size_t gate_off
 
 void UltraComposer::process_ROM_arrays(const size_t gate_offset_from_public_inputs)
 {
+    // Sorting the transcripts is independent across arrays, whereas the gates must be added one array at a time. Only
+    // split across arrays if there are several, so a single large array can use every thread for its own sort.
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for if (rom_arrays.size() > 1)
+#endif
+    for (size_t i = 0; i < rom_arrays.size(); ++i) {
+        sort_memory_records(rom_arrays[i].records, rom_arrays[i].state.size());
+    }
     for (size_t i = 0; i < rom_arrays.size(); ++i) {
         process_ROM_array(i, gate_offset_from_public_inputs);
     }
 }
 void UltraComposer::process_RAM_arrays(const size_t gate_offset_from_public_inputs)
 {
+    // Sorting the transcripts is independent across arrays, whereas the gates must be added one array at a time. Only
+    // split across arrays if there are several, so a single large array can use every thread for its own sort.
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for if (ram_arrays.size() > 1)
+#endif
+    for (size_t i = 0; i < ram_arrays.size(); ++i) {
+        sort_memory_records(ram_arrays[i].records, ram_arrays[i].state.size());
+    }
     for (size_t i = 0; i < ram_arrays.size(); ++i) {
         process_RAM_array(i, gate_offset_from_public_inputs);
     }
@@ -43,17 +43,11 @@ void KateCommitmentScheme<settings>::compute_opening_polynomial(const fr* src,
     // the blinding of the quotient polynomial parts.
     fr f = polynomial_arithmetic::evaluate(src, z_point, n + 1);
 
-    // compute (1 / -z)
-    fr divisor = -z_point.invert();
-
-    // we're about to shove these coefficients into a pippenger multi-exponentiation routine, where we need
-    // to convert out of montgomery form. So, we can use lazy reduction techniques here without triggering overflows
-    dest[0] = src[0] - f;
-    dest[0] *= divisor;
-    for (size_t i = 1; i < n; ++i) {
-        dest[i] = src[i] - dest[i - 1];
-        dest[i] *= divisor;
+    if (src != dest) {
+        polynomial_arithmetic::copy_polynomial(src, dest, n, n);
     }
+    dest[0] -= f;
+    polynomial_arithmetic::divide_by_linear_factors<fr>(std::span{ &dest, 1 }, n, std::span{ &z_point, 1 });
 }
 
 template <typename settings>
@@ -154,23 +148,26 @@ void KateCommitmentScheme<settings>::batch_open(const transcript::StandardTransc
     //
     // Note that the challenges nu_1, ..., nu_6 depend on the label of the respective polynomial.
 
+    const auto& indices = get_transcript_indices(transcript, input_key->polynomial_manifest);
+
     // Add challenge-poly tuples for all polynomials in the manifest
     for (size_t i = 0; i < input_key->polynomial_manifest.size(); ++i) {
         const auto& info = input_key->polynomial_manifest[i];
+        const auto& opening = indices.openings[i];
         const std::string poly_label(info.polynomial_label);
 
         fr* poly = input_key->polynomial_store.get(poly_label).get_coefficients();
 
-        const fr nu_challenge = transcript.get_challenge_field_element_from_map("nu", poly_label);
+        const fr nu_challenge = transcript.get_challenge_field_element_from_map(indices.nu, opening.nu);
         opened_polynomials_at_zeta.push_back({ poly, nu_challenge });
 
         if (info.requires_shifted_evaluation) {
-            const auto nu_challenge = transcript.get_challenge_field_element_from_map("nu", poly_label + "_omega");
+            const auto nu_challenge = transcript.get_challenge_field_element_from_map(indices.nu, opening.shifted_nu);
             opened_polynomials_at_zeta_omega.push_back({ poly, nu_challenge });
         }
     }
 
-    const auto zeta = transcript.get_challenge_field_element("z");
+    const auto zeta = transcript.get_challenge_field_element(indices.z);
 
     // Note: the opening poly W_\frak{z} is always size (n + 1) due to blinding
     // of the quotient polynomial
@@ -260,14 +257,15 @@ void KateCommitmentScheme<settings>::batch_verify(const transcript::StandardTran
 
     fr batch_eval(0);
     const auto& polynomial_manifest = input_key->polynomial_manifest;
+    const auto& indices = get_transcript_indices(transcript, polynomial_manifest);
     for (size_t i = 0; i < input_key->polynomial_manifest.size(); ++i) {
         const auto& item = polynomial_manifest[i];
+        const auto& opening = indices.openings[i];
         const std::string label(item.commitment_label);
-        const std::string poly_label(item.polynomial_label);
         switch (item.source) {
         case PolynomialSource::WITNESS: {
             // add [a]_1, [b]_1, [c]_1 to the group elements' vector
-            const auto element = transcript.get_group_element(label);
+            const auto element = transcript.get_group_element(indices.commitments[i]);
             // rule out bad points and points at infinity (just to be on the safe side. all-zero witnesses won't be
             // zero-knowledge!)
             if (!element.on_curve() || element.is_point_at_infinity()) {
@@ -302,35 +300,36 @@ void KateCommitmentScheme<settings>::batch_verify(const transcript::StandardTran
         if (has_shifted_evaluation) {
 
             // compute scalar additively for the batch opening commitment [F]_1
-            const auto challenge = transcript.get_challenge_field_element_from_map("nu", poly_label + "_omega");
-            const auto separator_challenge = transcript.get_challenge_field_element("separator", 0);
+            const auto challenge = transcript.get_challenge_field_element_from_map(indices.nu, opening.shifted_nu);
+            const auto separator_challenge = transcript.get_challenge_field_element(indices.separator, 0);
             kate_fr_scalar += (separator_challenge * challenge);
 
             // compute the batch evaluation scalar additively for the batch evaluation commitment [E]_1
-            const auto poly_at_zeta_omega = transcript.get_field_element(poly_label + "_omega");
+            const auto poly_at_zeta_omega = transcript.get_field_element(opening.shifted_evaluation);
             batch_eval += separator_challenge * challenge * poly_at_zeta_omega;
         }
 
         // compute scalar additively for the batch opening commitment [F]_1
-        const auto challenge = transcript.get_challenge_field_element_from_map("nu", poly_label);
+        const auto challenge = transcript.get_challenge_field_element_from_map(indices.nu, opening.nu);
         kate_fr_scalar += challenge;
 
         // compute the batch evaluation scalar additively for the batch evaluation commitment [E]_1
-        const auto poly_at_zeta = transcript.get_field_element(poly_label);
+        const auto poly_at_zeta = transcript.get_field_element(opening.evaluation);
         batch_eval += challenge * poly_at_zeta;
 
         kate_fr_elements.insert({ label, kate_fr_scalar });
     }
 
-    const auto zeta = transcript.get_challenge_field_element("z");
-    barretenberg::fr quotient_challenge = transcript.get_challenge_field_element_from_map("nu", "t");
+    const auto zeta = transcript.get_challenge_field_element(indices.z);
+    barretenberg::fr quotient_challenge =
+        transcript.get_challenge_field_element_from_map(indices.nu, indices.quotient_nu);
 
     // append the commitments to the parts of quotient polynomial and their scalar multiplicands
     fr z_pow_n = zeta.pow(input_key->circuit_size);
     fr z_power = 1;
     for (size_t i = 0; i < settings::program_width; ++i) {
         std::string quotient_label = "T_" + std::to_string(i + 1);
-        const auto element = transcript.get_group_element(quotient_label);
+        const auto element = transcript.get_group_element(indices.quotient_commitments[i]);
 
         kate_g1_elements.insert({ quotient_label, element });
         kate_fr_elements.insert({ quotient_label, quotient_challenge * z_power });
@@ -338,7 +337,7 @@ void KateCommitmentScheme<settings>::batch_verify(const transcript::StandardTran
     }
 
     // add the quotient eval t_eval term to batch evaluation
-    const auto quotient_eval = transcript.get_field_element("t");
+    const auto quotient_eval = transcript.get_field_element(indices.quotient_evaluation);
     batch_eval += (quotient_eval * quotient_challenge);
 
     // append batch evaluation in the scalar element vector map
@@ -356,15 +355,34 @@ void KateCommitmentScheme<settings>::add_opening_evaluations_to_transcript(
     // We also allow this evaluation computation for lagrange (evaluation) forms of polynomials instead of
     // the usual coefficient forms.
     //
-    fr zeta = fr::serialize_from_buffer(transcript.get_challenge("z").begin());
+    const auto& indices = get_transcript_indices(transcript, input_key->polynomial_manifest);
+    fr zeta = transcript.get_challenge_field_element(indices.z);
     fr shifted_z = zeta * input_key->small_domain.root;
     size_t n = input_key->small_domain.size;
 
-    for (size_t i = 0; i < input_key->polynomial_manifest.size(); ++i) {
+    const size_t num_polynomials = input_key->polynomial_manifest.size();
+    std::vector<const fr*> polynomials(num_polynomials);
+    for (size_t i = 0; i < num_polynomials; ++i) {
+        const std::string poly_label(input_key->polynomial_manifest[i].polynomial_label);
+        polynomials[i] = input_key->polynomial_store.get(poly_label).get_coefficients();
+    }
+
+    // In coefficient form, evaluate everything at zeta (and zeta * omega where needed) in one pass
+    std::vector<fr> evaluations;
+    if (!in_lagrange_form) {
+        const std::array<fr, 2> points{ zeta, shifted_z };
+        std::vector<uint64_t> point_masks(num_polynomials);
+        for (size_t i = 0; i < num_polynomials; ++i) {
+            point_masks[i] = input_key->polynomial_manifest[i].requires_shifted_evaluation ? 0b11 : 0b01;
+        }
+        evaluations = polynomial_arithmetic::batch_evaluate<fr>(polynomials, n, points, point_masks);
+    }
+
+    for (size_t i = 0; i < num_polynomials; ++i) {
         const auto& info = input_key->polynomial_manifest[i];
-        const std::string poly_label(info.polynomial_label);
+        const auto& opening = indices.openings[i];
 
-        fr* poly = input_key->polynomial_store.get(poly_label).get_coefficients();
+        const fr* poly = polynomials[i];
 
         fr poly_evaluation(0);
 
@@ -372,20 +390,63 @@ void KateCommitmentScheme<settings>::add_opening_evaluations_to_transcript(
             poly_evaluation =
                 polynomial_arithmetic::compute_barycentric_evaluation(poly, n, zeta, input_key->small_domain);
         } else {
-            poly_evaluation = polynomial_arithmetic::evaluate(poly, zeta, n);
+            poly_evaluation = evaluations[2 * i];
         }
-        transcript.add_element(poly_label, poly_evaluation.to_buffer());
+        transcript.add_field_element(opening.evaluation, poly_evaluation);
 
         if (info.requires_shifted_evaluation) {
             if (in_lagrange_form) {
                 poly_evaluation =
                     polynomial_arithmetic::compute_barycentric_evaluation(poly, n, zeta, input_key->small_domain);
             } else {
-                poly_evaluation = polynomial_arithmetic::evaluate(poly, shifted_z, n);
+                poly_evaluation = evaluations[2 * i + 1];
             }
-            transcript.add_element(poly_label + "_omega", poly_evaluation.to_buffer());
+            transcript.add_field_element(opening.shifted_evaluation, poly_evaluation);
+        }
+    }
+}
+
+template <typename settings>
+const typename KateCommitmentScheme<settings>::TranscriptIndices& KateCommitmentScheme<
+    settings>::get_transcript_indices(const transcript::StandardTranscript& transcript,
+                                      const PolynomialManifest& polynomial_manifest)
+{
+    const auto& layout = transcript.get_manifest().get_shared_layout();
+    if (transcript_indices.layout == layout && transcript_indices.polynomial_manifest == polynomial_manifest) {
+        return transcript_indices;
+    }
+
+    TranscriptIndices indices;
+    indices.layout = layout;
+    indices.polynomial_manifest = polynomial_manifest;
+    indices.z = transcript.get_challenge_index("z");
+    indices.nu = transcript.get_challenge_index("nu");
+    indices.separator = transcript.get_challenge_index("separator");
+    indices.quotient_evaluation = transcript.get_element_index("t");
+    indices.quotient_nu = transcript.get_challenge_index_from_map("t");
+    for (size_t i = 0; i < settings::program_width; ++i) {
+        indices.quotient_commitments[i] = transcript.get_element_index("T_" + std::to_string(i + 1));
+    }
+
+    const size_t num_polynomials = polynomial_manifest.size();
+    indices.commitments.resize(num_polynomials);
+    indices.openings.resize(num_polynomials);
+    for (size_t i = 0; i < num_polynomials; ++i) {
+        const auto& info = polynomial_manifest[i];
+        const std::string poly_label(info.polynomial_label);
+        if (info.source == PolynomialSource::WITNESS) {
+            indices.commitments[i] = transcript.get_element_index(info.commitment_label);
+        }
+        auto& opening = indices.openings[i];
+        opening.evaluation = transcript.get_element_index(poly_label);
+        opening.nu = transcript.get_challenge_index_from_map(poly_label);
+        if (info.requires_shifted_evaluation) {
+            opening.shifted_evaluation = transcript.get_element_index(poly_label + "_omega");
+            opening.shifted_nu = transcript.get_challenge_index_from_map(poly_label + "_omega");
         }
     }
+    transcript_indices = std::move(indices);
+    return transcript_indices;
 }
 
 template class KateCommitmentScheme<standard_settings>;
@@ -36,7 +36,41 @@ template <typename settings> class KateCommitmentScheme : public CommitmentSchem
                                                bool in_lagrange_form = false) override;
 
   private:
+    /**
+     * @brief Where batch_open, batch_verify and add_opening_evaluations_to_transcript find their data in the
+     * transcript. The indices only depend on the transcript and polynomial manifests, so they are resolved on first use
+     * and reused for every proof made or verified with the same manifests.
+     */
+    struct TranscriptIndices {
+        // The evaluations of a polynomial at zeta (and zeta.omega) and their nu challenge map indices
+        struct Opening {
+            size_t evaluation;
+            size_t shifted_evaluation;
+            int nu;
+            int shifted_nu;
+        };
+
+        // The manifests the indices were resolved from. Both are held rather than pointed to, so a manifest freed
+        // and replaced by another at the same address cannot hit the cache.
+        std::shared_ptr<const transcript::Manifest::Layout> layout;
+        PolynomialManifest polynomial_manifest;
+
+        size_t z;
+        size_t nu;
+        size_t separator;
+        size_t quotient_evaluation;
+        int quotient_nu;
+        std::array<size_t, settings::program_width> quotient_commitments;
+        // One per polynomial manifest entry; commitments are only resolved for witnesses
+        std::vector<size_t> commitments;
+        std::vector<Opening> openings;
+    };
+
+    const TranscriptIndices& get_transcript_indices(const transcript::StandardTranscript& transcript,
+                                                    const PolynomialManifest& polynomial_manifest);
+
     plonk::commitment_open_proof kate_open_proof;
+    TranscriptIndices transcript_indices;
 };
 
 extern template class KateCommitmentScheme<standard_settings>;
@@ -500,15 +500,23 @@ template <typename settings> void ProverBase<settings>::compute_quotient_evaluat
 
     commitment_scheme->add_opening_evaluations_to_transcript(transcript, key, false);
 
-    fr t_eval = polynomial_arithmetic::evaluate({ &key->quotient_polynomial_parts[0][0],
-                                                  &key->quotient_polynomial_parts[1][0],
-                                                  &key->quotient_polynomial_parts[2][0],
-                                                  &key->quotient_polynomial_parts[3][0] },
-                                                zeta,
-                                                4 * circuit_size);
+    // t(ʓ) = t_1(ʓ) + ʓ^n⋅t_2(ʓ) + ʓ^2n⋅t_3(ʓ) + ʓ^3n⋅t_4(ʓ), over the first n coefficients of each part
+    const std::array<const fr*, 4> quotient_parts{ &key->quotient_polynomial_parts[0][0],
+                                                   &key->quotient_polynomial_parts[1][0],
+                                                   &key->quotient_polynomial_parts[2][0],
+                                                   &key->quotient_polynomial_parts[3][0] };
+    const auto part_evaluations =
+        polynomial_arithmetic::batch_evaluate<fr>(quotient_parts, circuit_size, std::span{ &zeta, 1 });
 
     fr zeta_pow_n = zeta.pow(key->circuit_size);
-    fr scalar = zeta_pow_n;
+    fr t_eval = fr::zero();
+    fr scalar = fr::one();
+    for (const auto& part_evaluation : part_evaluations) {
+        t_eval += part_evaluation * scalar;
+        scalar *= zeta_pow_n;
+    }
+
+    scalar = zeta_pow_n;
     // Adjust the evaluation to consider the (n + 1)th coefficient when needed (note that width 3 is just an avatar for
     // StandardComposer here)
     const size_t num_deg_n_poly = settings::program_width == 3 ? settings::program_width : settings::program_width - 1;
@@ -565,34 +573,47 @@ template <typename settings> plonk::proof& ProverBase<settings>::export_proof()
 }
 
 template <typename settings> plonk::proof& ProverBase<settings>::construct_proof()
+{
+    return construct_proof([](std::string_view) {});
+}
+
+template <typename settings>
+plonk::proof& ProverBase<settings>::construct_proof(const RoundCallback& round_completed)
 {
     // Execute init round. Randomize witness polynomials.
     execute_preamble_round();
     queue.process_queue();
+    round_completed("preamble");
 
     // Compute wire precommitments and sometimes random widget round commitments
     execute_first_round();
     queue.process_queue();
+    round_completed("first");
 
     // Fiat-Shamir eta + execute random widgets.
     execute_second_round();
     queue.process_queue();
+    round_completed("second");
 
     // Fiat-Shamir beta & gamma, execute random widgets (Permutation widget is executed here)
     // and fft the witnesses
     execute_third_round();
     queue.process_queue();
+    round_completed("third");
 
     // Fiat-Shamir alpha, compute & commit to quotient polynomial.
     execute_fourth_round();
     queue.process_queue();
+    round_completed("fourth");
 
     execute_fifth_round();
+    round_completed("fifth");
 
     execute_sixth_round();
     queue.process_queue();
 
     queue.flush_queue();
+    round_completed("sixth");
 
     return export_proof();
 }
@@ -6,12 +6,17 @@
 #include "../../../proof_system/work_queue/work_queue.hpp"
 #include "../widgets/transition_widgets/transition_widget.hpp"
 #include "../commitment_scheme/commitment_scheme.hpp"
+#include <functional>
+#include <string_view>
 
 namespace proof_system::plonk {
 
 template <typename settings> class ProverBase {
 
   public:
+    // Called with the name of each round of construct_proof() once it (and the work it queued) is done
+    using RoundCallback = std::function<void(std::string_view round)>;
+
     ProverBase(std::shared_ptr<proving_key> input_key = nullptr,
                const transcript::Manifest& manifest = transcript::Manifest());
     ProverBase(ProverBase&& other);
@@ -40,6 +45,7 @@ template <typename settings> class ProverBase {
     void compute_lagrange_1_fft();
     plonk::proof& export_proof();
     plonk::proof& construct_proof();
+    plonk::proof& construct_proof(const RoundCallback& round_completed);
 
     size_t get_circuit_size() const { return circuit_size; }
 
@@ -2,9 +2,28 @@
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/fixed_base_point_table.hpp"
 
 namespace proof_system::plonk {
 
+namespace {
+/**
+ * The runtime state for commitments of up to n + 1 points. A precomputed fixed-base table spreads each commitment over
+ * several copies of the points, so the state then has to be that many times larger. If that doesn't fit in
+ * max_memory, the state is built for chunks of the commitment instead (and the fixed-base table goes unused).
+ */
+barretenberg::scalar_multiplication::pippenger_runtime_state make_pippenger_runtime_state(
+    std::shared_ptr<proof_system::ProverReferenceString> const& crs, const size_t circuit_size, const size_t max_memory)
+{
+    size_t num_points = circuit_size + 1;
+    auto fixed_base_table = crs != nullptr ? crs->get_fixed_base_table() : nullptr;
+    if (fixed_base_table != nullptr && fixed_base_table->is_worthwhile(circuit_size + 1)) {
+        num_points = std::max(circuit_size + 1, fixed_base_table->get_runtime_state_size());
+    }
+    return barretenberg::scalar_multiplication::pippenger_runtime_state(num_points, max_memory);
+}
+} // namespace
+
 // In all the constructors below, the pippenger_runtime_state takes (n + 1) as the input
 // as the degree of t_{high}(X) is (n + 1) for standard plonk. Refer to
 // ./src/barretenberg/plonk/proof_system/prover/prover.cpp/ProverBase::compute_quotient_commitments
@@ -21,11 +40,15 @@ namespace proof_system::plonk {
  * proving_key constructor.
  *
  * Delegates to proving_key::init
+ *
+ * @param max_pippenger_memory Cap on the bytes held by pippenger_runtime_state. Commitments to polynomials longer than
+ * what then fits are computed in chunks (see scalar_multiplication::pippenger).
  * */
 proving_key::proving_key(const size_t num_gates,
                          const size_t num_inputs,
                          std::shared_ptr<proof_system::ProverReferenceString> const& crs,
-                         ComposerType type = ComposerType::STANDARD) // TODO(Cody): Don't use default for Honk
+                         ComposerType type = ComposerType::STANDARD, // TODO(Cody): Don't use default for Honk
+                         const size_t max_pippenger_memory)
     : composer_type(type)
     , circuit_size(num_gates)
     , log_circuit_size(numeric::get_msb(num_gates))
@@ -33,7 +56,7 @@ proving_key::proving_key(const size_t num_gates,
     , small_domain(circuit_size, circuit_size)
     , large_domain(4 * circuit_size, circuit_size > min_thread_block ? circuit_size : 4 * circuit_size)
     , reference_string(crs)
-    , pippenger_runtime_state(circuit_size + 1)
+    , pippenger_runtime_state(make_pippenger_runtime_state(crs, circuit_size, max_pippenger_memory))
     , polynomial_manifest((uint32_t)type)
 {
     init();
@@ -44,8 +67,11 @@ proving_key::proving_key(const size_t num_gates,
  *
  * @param data
  * @param crs
+ * @param max_pippenger_memory Cap on the bytes held by pippenger_runtime_state, as above
  */
-proving_key::proving_key(proving_key_data&& data, std::shared_ptr<proof_system::ProverReferenceString> const& crs)
+proving_key::proving_key(proving_key_data&& data,
+                         std::shared_ptr<proof_system::ProverReferenceString> const& crs,
+                         const size_t max_pippenger_memory)
     : composer_type(data.composer_type)
     , circuit_size(data.circuit_size)
     , num_public_inputs(data.num_public_inputs)
@@ -57,7 +83,7 @@ proving_key::proving_key(proving_key_data&& data, std::shared_ptr<proof_system::
     , small_domain(circuit_size, circuit_size)
     , large_domain(4 * circuit_size, circuit_size > min_thread_block ? circuit_size : 4 * circuit_size)
     , reference_string(crs)
-    , pippenger_runtime_state(circuit_size + 1)
+    , pippenger_runtime_state(make_pippenger_runtime_state(crs, circuit_size, max_pippenger_memory))
     , polynomial_manifest(data.composer_type)
 {
     init();
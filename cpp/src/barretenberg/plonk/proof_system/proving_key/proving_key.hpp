@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/ecc/curves/bn254/scalar_multiplication/runtime_states.hpp"
+#include <limits>
 #include <map>
 #include "barretenberg/polynomials/evaluation_domain.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
@@ -31,12 +32,17 @@ struct proving_key {
         RELATIVE_LOOKUP,
     };
 
-    proving_key(proving_key_data&& data, std::shared_ptr<ProverReferenceString> const& crs);
+    static constexpr size_t UNLIMITED_PIPPENGER_MEMORY = std::numeric_limits<size_t>::max();
+
+    proving_key(proving_key_data&& data,
+                std::shared_ptr<ProverReferenceString> const& crs,
+                const size_t max_pippenger_memory = UNLIMITED_PIPPENGER_MEMORY);
 
     proving_key(const size_t num_gates,
                 const size_t num_inputs,
                 std::shared_ptr<ProverReferenceString> const& crs,
-                ComposerType type);
+                ComposerType type,
+                const size_t max_pippenger_memory = UNLIMITED_PIPPENGER_MEMORY);
 
     proving_key(std::ostream& is, std::string const& crs_path);
 
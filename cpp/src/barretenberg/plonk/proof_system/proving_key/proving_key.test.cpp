@@ -151,3 +151,18 @@ TEST(proving_key, proving_key_from_mmaped_key)
     EXPECT_EQ(p_key.contains_recursive_proof, pk_data.contains_recursive_proof);
 }
 #endif
+
+// A memory cap passed at construction sizes the key's Pippenger state for chunks of the commitments
+TEST(proving_key, pippenger_memory_limit)
+{
+    using barretenberg::scalar_multiplication::pippenger_runtime_state;
+    constexpr size_t chunk_points = pippenger_runtime_state::MIN_CHUNK_POINTS;
+    constexpr size_t circuit_size = 4 * chunk_points;
+
+    plonk::proving_key unbounded_key(circuit_size, 0, nullptr, ComposerType::STANDARD);
+    EXPECT_EQ(unbounded_key.pippenger_runtime_state.get_max_num_initial_points(), circuit_size + 1);
+
+    const size_t max_memory = pippenger_runtime_state::get_memory_size(chunk_points);
+    plonk::proving_key bounded_key(circuit_size, 0, nullptr, ComposerType::STANDARD, max_memory);
+    EXPECT_EQ(bounded_key.pippenger_runtime_state.get_max_num_initial_points(), chunk_points);
+}
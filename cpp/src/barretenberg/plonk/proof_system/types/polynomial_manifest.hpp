@@ -81,6 +81,7 @@ struct PolynomialDescriptor {
         index = other.index;
         return *this;
     };
+    constexpr bool operator==(const PolynomialDescriptor& other) const = default;
 
     std::string_view commitment_label;
     std::string_view polynomial_label;
@@ -205,6 +206,8 @@ class PolynomialManifest {
     size_t size() const { return manifest.size(); }
 
     PolynomialDescriptor operator[](size_t index) const { return manifest[index]; }
+
+    bool operator==(const PolynomialManifest& other) const = default;
 };
 
 // This class constructs and provides access to a full list of pre-computed
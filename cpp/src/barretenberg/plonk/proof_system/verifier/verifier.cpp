@@ -144,8 +144,8 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     program_settings::append_scalar_multiplication_inputs(key.get(), alpha, transcript, kate_fr_elements);
 
     // Fetch the group elements [W_z]_1,[W_zω]_1 from the transcript
-    g1::affine_element PI_Z = g1::affine_element::serialize_from_buffer(&transcript.get_element("PI_Z")[0]);
-    g1::affine_element PI_Z_OMEGA = g1::affine_element::serialize_from_buffer(&transcript.get_element("PI_Z_OMEGA")[0]);
+    g1::affine_element PI_Z = transcript.get_group_element("PI_Z");
+    g1::affine_element PI_Z_OMEGA = transcript.get_group_element("PI_Z_OMEGA");
 
     // Validate PI_Z, PI_Z_OMEGA are valid ecc points.
     // N.B. we check that witness commitments are valid points in KateCommitmentScheme<settings>::batch_verify
@@ -110,7 +110,7 @@ template <class Field, class Transcript, class Settings, size_t num_widget_relat
          *
          * */
 
-        auto add_challenge = [transcript,
+        auto add_challenge = [&transcript,
                               &result](const auto label, const auto tag, const bool required, const size_t index = 0) {
             ASSERT(!required || transcript.has_challenge(label));
             if (transcript.has_challenge(label)) {
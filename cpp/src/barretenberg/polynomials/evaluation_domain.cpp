@@ -18,11 +18,7 @@ constexpr size_t MIN_GROUP_PER_THREAD = 4;
 
 size_t compute_num_threads(const size_t size)
 {
-#ifndef NO_MULTITHREADING
     size_t num_threads = max_threads::compute_num_threads();
-#else
-    size_t num_threads = 1;
-#endif
     if (size <= (num_threads * MIN_GROUP_PER_THREAD)) {
         num_threads = 1;
     }
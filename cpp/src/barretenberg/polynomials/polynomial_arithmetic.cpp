@@ -6,6 +6,7 @@
 #include <memory.h>
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/thread.hpp"
 
 namespace barretenberg::polynomial_arithmetic {
 
@@ -118,10 +119,7 @@ void scale_by_generator(Fr* coeffs,
                         const Fr& generator_shift,
                         const size_t generator_size)
 {
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t j = 0; j < domain.num_threads; ++j) {
+    parallel_for(domain.num_threads, [&](size_t j) {
         Fr thread_shift = generator_shift.pow(static_cast<uint64_t>(j * (generator_size / domain.num_threads)));
         Fr work_generator = generator_start * thread_shift;
         const size_t offset = j * (generator_size / domain.num_threads);
@@ -130,7 +128,7 @@ void scale_by_generator(Fr* coeffs,
             target[i] = coeffs[i] * work_generator;
             work_generator *= generator_shift;
         }
-    }
+    });
 }
 /**
  * Compute multiplicative subgroup (g.X)^n.
@@ -179,44 +177,125 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
     const size_t poly_mask = poly_size - 1;
     const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
 
+    // First FFT round is a special case - no need to multiply by root table, because all entries are 1.
+    // We also combine the bit reversal step into the first round, to avoid a redundant round of copying data
+    const auto first_round = [&](size_t j) {
+        Fr temp_1;
+        Fr temp_2;
+        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
+            uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
+            uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
+            __builtin_prefetch(&coeffs[next_index_1]);
+            __builtin_prefetch(&coeffs[next_index_2]);
+
+            uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
+            uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
+
+            size_t poly_idx_1 = swap_index_1 >> log2_poly_size;
+            size_t elem_idx_1 = swap_index_1 & poly_mask;
+            size_t poly_idx_2 = swap_index_2 >> log2_poly_size;
+            size_t elem_idx_2 = swap_index_2 & poly_mask;
+
+            Fr::__copy(coeffs[poly_idx_1][elem_idx_1], temp_1);
+            Fr::__copy(coeffs[poly_idx_2][elem_idx_2], temp_2);
+            scratch_space[i + 1] = temp_1 - temp_2;
+            scratch_space[i] = temp_1 + temp_2;
+        }
+    };
+
+    // One round of the outer FFT loop, over thread j's share of the domain
+    const auto butterfly_round = [&](size_t j, size_t m) {
+        Fr temp;
+
+        // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
+        // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
+        // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
+        // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
+
+        // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
+        // directly access the roots of unity lookup table
+        const size_t start = j * (domain.thread_size >> 1);
+        const size_t end = (j + 1) * (domain.thread_size >> 1);
+
+        // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
+        // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
+        //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
+        //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
+        //      roots of unity
+        // i.e. each successive FFT round will double the set of roots that we need to index.
+        // We have already laid out the `root_table` container so that each FFT round's roots are linearly
+        // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
+        // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
+        // of size x, the first x iterations will index the subgroup elements in order, then for the next x
+        // iterations, we loop back to the start.
+
+        // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
+        // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
+        // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
+        // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
+        // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
+        // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
+        const size_t block_mask = m - 1;
+
+        // The next problem to tackle, is we now need to efficiently index the polynomial element in
+        // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
+        // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
+        // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
+        // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
+        // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
+        // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
+        // block_mask)`
+        const size_t index_mask = ~block_mask;
+
+        // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
+        // our indexer, because we don't store the precomputed root values for the 1st round (because they're
+        // all 1).
+        const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+
+        // Finally, we want to treat the final round differently from the others,
+        // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
+        // `scratch_space`
+        if (m != (domain.size >> 1)) {
+            for (size_t i = start; i < end; ++i) {
+                size_t k1 = (i & index_mask) << 1;
+                size_t j1 = i & block_mask;
+                temp = round_roots[j1] * scratch_space[k1 + j1 + m];
+                scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
+                scratch_space[k1 + j1] += temp;
+            }
+        } else {
+            for (size_t i = start; i < end; ++i) {
+                size_t k1 = (i & index_mask) << 1;
+                size_t j1 = i & block_mask;
+
+                size_t poly_idx_1 = (k1 + j1) >> log2_poly_size;
+                size_t elem_idx_1 = (k1 + j1) & poly_mask;
+                size_t poly_idx_2 = (k1 + j1 + m) >> log2_poly_size;
+                size_t elem_idx_2 = (k1 + j1 + m) & poly_mask;
+
+                temp = round_roots[j1] * scratch_space[k1 + j1 + m];
+                coeffs[poly_idx_2][elem_idx_2] = scratch_space[k1 + j1] - temp;
+                coeffs[poly_idx_1][elem_idx_1] = scratch_space[k1 + j1] + temp;
+            }
+        }
+    };
+
+#ifdef WASM_THREADS
+    // The wasm thread pool has no persistent parallel region, so each round is its own parallel_for
+    parallel_for(domain.num_threads, first_round);
+    for (size_t m = 2; m < (domain.size); m <<= 1) {
+        parallel_for(domain.num_threads, [&](size_t j) { butterfly_round(j, m); });
+    }
+#else
 #ifndef NO_MULTITHREADING
 #pragma omp parallel
 #endif
     {
-// First FFT round is a special case - no need to multiply by root table, because all entries are 1.
-// We also combine the bit reversal step into the first round, to avoid a redundant round of copying data
 #ifndef NO_MULTITHREADING
 #pragma omp for
 #endif
         for (size_t j = 0; j < domain.num_threads; ++j) {
-            Fr temp_1;
-            Fr temp_2;
-            for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
-                uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
-                uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
-                __builtin_prefetch(&coeffs[next_index_1]);
-                __builtin_prefetch(&coeffs[next_index_2]);
-
-                uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
-                uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
-
-                size_t poly_idx_1 = swap_index_1 >> log2_poly_size;
-                size_t elem_idx_1 = swap_index_1 & poly_mask;
-                size_t poly_idx_2 = swap_index_2 >> log2_poly_size;
-                size_t elem_idx_2 = swap_index_2 & poly_mask;
-
-                Fr::__copy(coeffs[poly_idx_1][elem_idx_1], temp_1);
-                Fr::__copy(coeffs[poly_idx_2][elem_idx_2], temp_2);
-                scratch_space[i + 1] = temp_1 - temp_2;
-                scratch_space[i] = temp_1 + temp_2;
-            }
-        }
-
-        // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-        // reduce + copy
-        if (domain.size <= 2) {
-            coeffs[0][0] = scratch_space[0];
-            coeffs[0][1] = scratch_space[1];
+            first_round(j);
         }
 
         // outer FFT loop
@@ -225,121 +304,122 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
 #pragma omp for
 #endif
             for (size_t j = 0; j < domain.num_threads; ++j) {
-                Fr temp;
-
-                // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-                // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-                // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-                // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-                // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-                // directly access the roots of unity lookup table
-                const size_t start = j * (domain.thread_size >> 1);
-                const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-                // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-                // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-                //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-                //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-                //      roots of unity
-                // i.e. each successive FFT round will double the set of roots that we need to index.
-                // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-                // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-                // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-                // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-                // iterations, we loop back to the start.
-
-                // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-                // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-                // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-                // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-                // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-                // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-                const size_t block_mask = m - 1;
-
-                // The next problem to tackle, is we now need to efficiently index the polynomial element in
-                // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-                // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-                // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-                // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-                // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-                // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-                // block_mask)`
-                const size_t index_mask = ~block_mask;
-
-                // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-                // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-                // all 1).
-                const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-                // Finally, we want to treat the final round differently from the others,
-                // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-                // `scratch_space`
-                if (m != (domain.size >> 1)) {
-                    for (size_t i = start; i < end; ++i) {
-                        size_t k1 = (i & index_mask) << 1;
-                        size_t j1 = i & block_mask;
-                        temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                        scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
-                        scratch_space[k1 + j1] += temp;
-                    }
-                } else {
-                    for (size_t i = start; i < end; ++i) {
-                        size_t k1 = (i & index_mask) << 1;
-                        size_t j1 = i & block_mask;
-
-                        size_t poly_idx_1 = (k1 + j1) >> log2_poly_size;
-                        size_t elem_idx_1 = (k1 + j1) & poly_mask;
-                        size_t poly_idx_2 = (k1 + j1 + m) >> log2_poly_size;
-                        size_t elem_idx_2 = (k1 + j1 + m) & poly_mask;
-
-                        temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                        coeffs[poly_idx_2][elem_idx_2] = scratch_space[k1 + j1] - temp;
-                        coeffs[poly_idx_1][elem_idx_1] = scratch_space[k1 + j1] + temp;
-                    }
-                }
+                butterfly_round(j, m);
             }
         }
     }
+#endif
+
+    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
+    // reduce + copy
+    if (domain.size <= 2) {
+        coeffs[0][0] = scratch_space[0];
+        coeffs[0][1] = scratch_space[1];
+    }
 }
 
 template <typename Fr>
 void fft_inner_parallel(
     Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr&, const std::vector<Fr*>& root_table)
 {
+    // First FFT round is a special case - no need to multiply by root table, because all entries are 1.
+    // We also combine the bit reversal step into the first round, to avoid a redundant round of copying data
+    const auto first_round = [&](size_t j) {
+        Fr temp_1;
+        Fr temp_2;
+        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
+            uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
+            uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
+            __builtin_prefetch(&coeffs[next_index_1]);
+            __builtin_prefetch(&coeffs[next_index_2]);
+
+            uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
+            uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
+
+            Fr::__copy(coeffs[swap_index_1], temp_1);
+            Fr::__copy(coeffs[swap_index_2], temp_2);
+            target[i + 1] = temp_1 - temp_2;
+            target[i] = temp_1 + temp_2;
+        }
+    };
+
+    // One round of the outer FFT loop, over thread j's share of the domain
+    const auto butterfly_round = [&](size_t j, size_t m) {
+        Fr temp;
+
+        // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
+        // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
+        // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
+        // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
+
+        // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
+        // directly access the roots of unity lookup table
+        const size_t start = j * (domain.thread_size >> 1);
+        const size_t end = (j + 1) * (domain.thread_size >> 1);
+
+        // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
+        // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
+        //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
+        //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
+        //      roots of unity
+        // i.e. each successive FFT round will double the set of roots that we need to index.
+        // We have already laid out the `root_table` container so that each FFT round's roots are linearly
+        // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
+        // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
+        // of size x, the first x iterations will index the subgroup elements in order, then for the next x
+        // iterations, we loop back to the start.
+
+        // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
+        // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
+        // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
+        // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
+        // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
+        // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
+        const size_t block_mask = m - 1;
+
+        // The next problem to tackle, is we now need to efficiently index the polynomial element in
+        // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
+        // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
+        // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
+        // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
+        // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
+        // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
+        // block_mask)`
+        const size_t index_mask = ~block_mask;
+
+        // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
+        // our indexer, because we don't store the precomputed root values for the 1st round (because they're
+        // all 1).
+        const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+
+        // Finally, we want to treat the final round differently from the others,
+        // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
+        // `scratch_space`
+        for (size_t i = start; i < end; ++i) {
+            size_t k1 = (i & index_mask) << 1;
+            size_t j1 = i & block_mask;
+            temp = round_roots[j1] * target[k1 + j1 + m];
+            target[k1 + j1 + m] = target[k1 + j1] - temp;
+            target[k1 + j1] += temp;
+        }
+    };
+
+#ifdef WASM_THREADS
+    // The wasm thread pool has no persistent parallel region, so each round is its own parallel_for
+    parallel_for(domain.num_threads, first_round);
+    for (size_t m = 2; m < (domain.size); m <<= 1) {
+        parallel_for(domain.num_threads, [&](size_t j) { butterfly_round(j, m); });
+    }
+#else
 #ifndef NO_MULTITHREADING
 #pragma omp parallel
 #endif
     {
-// First FFT round is a special case - no need to multiply by root table, because all entries are 1.
-// We also combine the bit reversal step into the first round, to avoid a redundant round of copying data
 #ifndef NO_MULTITHREADING
 #pragma omp for
 #endif
         for (size_t j = 0; j < domain.num_threads; ++j) {
-            Fr temp_1;
-            Fr temp_2;
-            for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
-                uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
-                uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
-                __builtin_prefetch(&coeffs[next_index_1]);
-                __builtin_prefetch(&coeffs[next_index_2]);
-
-                uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
-                uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
-
-                Fr::__copy(coeffs[swap_index_1], temp_1);
-                Fr::__copy(coeffs[swap_index_2], temp_2);
-                target[i + 1] = temp_1 - temp_2;
-                target[i] = temp_1 + temp_2;
-            }
-        }
-
-        // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-        // reduce + copy
-        if (domain.size <= 2) {
-            coeffs[0] = target[0];
-            coeffs[1] = target[1];
+            first_round(j);
         }
 
         // outer FFT loop
@@ -348,66 +428,18 @@ void fft_inner_parallel(
 #pragma omp for
 #endif
             for (size_t j = 0; j < domain.num_threads; ++j) {
-                Fr temp;
-
-                // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-                // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-                // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-                // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-                // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-                // directly access the roots of unity lookup table
-                const size_t start = j * (domain.thread_size >> 1);
-                const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-                // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-                // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-                //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-                //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-                //      roots of unity
-                // i.e. each successive FFT round will double the set of roots that we need to index.
-                // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-                // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-                // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-                // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-                // iterations, we loop back to the start.
-
-                // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-                // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-                // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-                // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-                // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-                // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-                const size_t block_mask = m - 1;
-
-                // The next problem to tackle, is we now need to efficiently index the polynomial element in
-                // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-                // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-                // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-                // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-                // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-                // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-                // block_mask)`
-                const size_t index_mask = ~block_mask;
-
-                // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-                // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-                // all 1).
-                const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-                // Finally, we want to treat the final round differently from the others,
-                // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-                // `scratch_space`
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-                    temp = round_roots[j1] * target[k1 + j1 + m];
-                    target[k1 + j1 + m] = target[k1 + j1] - temp;
-                    target[k1 + j1] += temp;
-                }
+                butterfly_round(j, m);
             }
         }
     }
+#endif
+
+    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
+    // reduce + copy
+    if (domain.size <= 2) {
+        coeffs[0] = target[0];
+        coeffs[1] = target[1];
+    }
 }
 
 template <typename Fr>
@@ -580,6 +612,203 @@ template <typename Fr> void ifft(std::vector<Fr*> coeffs, const EvaluationDomain
     ITERATE_OVER_DOMAIN_END;
 }
 
+template <typename Fr>
+void fft_batch_rounds(std::span<Fr* const> polynomials,
+                      const EvaluationDomain<Fr>& domain,
+                      const std::vector<Fr*>& root_table,
+                      const size_t first_round_size)
+{
+    // Same butterflies as fft_inner_parallel, but in place and with the polynomials as the innermost loop, so each root
+    // of unity is loaded once for all of them. One round over thread j's share of the domain:
+    const auto butterfly_round = [&](size_t j, size_t m) {
+        const size_t start = j * (domain.thread_size >> 1);
+        const size_t end = (j + 1) * (domain.thread_size >> 1);
+        const size_t block_mask = m - 1;
+        const size_t index_mask = ~block_mask;
+
+        // First round is a special case - no need to multiply by root table, because all entries are 1.
+        if (m == 1) {
+            for (size_t i = start; i < end; ++i) {
+                for (Fr* coeffs : polynomials) {
+                    const Fr temp = coeffs[2 * i + 1];
+                    coeffs[2 * i + 1] = coeffs[2 * i] - temp;
+                    coeffs[2 * i] += temp;
+                }
+            }
+            return;
+        }
+
+        const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+        for (size_t i = start; i < end; ++i) {
+            const size_t k1 = (i & index_mask) << 1;
+            const size_t j1 = i & block_mask;
+            const Fr root = round_roots[j1];
+            for (Fr* coeffs : polynomials) {
+                const Fr temp = root * coeffs[k1 + j1 + m];
+                coeffs[k1 + j1 + m] = coeffs[k1 + j1] - temp;
+                coeffs[k1 + j1] += temp;
+            }
+        }
+    };
+
+#ifdef WASM_THREADS
+    // The wasm thread pool has no persistent parallel region, so each round is its own parallel_for
+    for (size_t m = first_round_size; m < domain.size; m <<= 1) {
+        parallel_for(domain.num_threads, [&](size_t j) { butterfly_round(j, m); });
+    }
+#else
+#ifndef NO_MULTITHREADING
+#pragma omp parallel
+#endif
+    for (size_t m = first_round_size; m < domain.size; m <<= 1) {
+#ifndef NO_MULTITHREADING
+#pragma omp for
+#endif
+        for (size_t j = 0; j < domain.num_threads; ++j) {
+            butterfly_round(j, m);
+        }
+    }
+#endif
+}
+
+template <typename Fr>
+void fft_batch_inner(std::span<Fr* const> polynomials,
+                     const EvaluationDomain<Fr>& domain,
+                     const std::vector<Fr*>& root_table)
+{
+    parallel_for(domain.num_threads, [&](size_t j) {
+        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); ++i) {
+            const size_t swap_index = reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
+            // Each index is swapped with its reverse exactly once, so the threads never touch the same pair
+            if (i < swap_index) {
+                for (Fr* coeffs : polynomials) {
+                    Fr::__swap(coeffs[i], coeffs[swap_index]);
+                }
+            }
+        }
+    });
+    fft_batch_rounds(polynomials, domain, root_table, 1);
+}
+
+template <typename Fr> void fft_batch(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain)
+{
+    fft_batch_inner(polynomials, domain, domain.get_round_roots());
+}
+
+template <typename Fr> void ifft_batch(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain)
+{
+    fft_batch_inner(polynomials, domain, domain.get_inverse_round_roots());
+    ITERATE_OVER_DOMAIN_START(domain);
+    for (Fr* coeffs : polynomials) {
+        coeffs[i] *= domain.domain_inverse;
+    }
+    ITERATE_OVER_DOMAIN_END;
+}
+
+template <typename Fr> void coset_fft_batch(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain)
+{
+    // scale_by_generator for every polynomial, computing each power of the generator once
+    parallel_for(domain.num_threads, [&](size_t j) {
+        const size_t range_per_thread = domain.generator_size / domain.num_threads;
+        const size_t offset = j * range_per_thread;
+        Fr work_generator = domain.generator.pow(static_cast<uint64_t>(offset));
+        for (size_t i = offset; i < offset + range_per_thread; ++i) {
+            for (Fr* coeffs : polynomials) {
+                coeffs[i] *= work_generator;
+            }
+            work_generator *= domain.generator;
+        }
+    });
+    fft_batch(polynomials, domain);
+}
+
+/**
+ * @brief Coset evaluations over large_domain of polynomials given in Lagrange form over small_domain
+ *
+ * @details Replaces ifft over small_domain, copying the result into a zero-padded buffer and coset_fft over
+ * large_domain. Padded with zeroes, the input of the large FFT is nonzero only at multiples of the extension factor
+ * once bit-reversed, so its first log2(extension) rounds just replicate each coefficient across a block; that
+ * replication is fused with the ifft normalisation, the scaling by powers of the coset generator and the bit-reversal,
+ * into a single pass that writes the large FFT's input straight into `coset_evaluations`. The large FFT then starts at
+ * the round operating on blocks of twice the extension factor.
+ *
+ * @param lagrange Evaluations over small_domain. Not modified.
+ * @param coset_evaluations Receives the evaluations over the coset of large_domain; needs large_domain.size elements.
+ * @param monomials If not empty, receives the monomial form (small_domain.size coefficients per polynomial).
+ */
+template <typename Fr>
+void coset_lde_from_lagrange(std::span<const Fr* const> lagrange,
+                             std::span<Fr* const> coset_evaluations,
+                             std::span<Fr* const> monomials,
+                             const EvaluationDomain<Fr>& small_domain,
+                             const EvaluationDomain<Fr>& large_domain)
+{
+    const size_t num_polys = lagrange.size();
+    ASSERT(coset_evaluations.size() == num_polys);
+    ASSERT(monomials.empty() || monomials.size() == num_polys);
+    ASSERT(large_domain.size % small_domain.size == 0);
+    const size_t extension = large_domain.size / small_domain.size;
+    ASSERT(is_power_of_two(extension));
+    const size_t n = small_domain.size;
+
+    // The monomial form, unnormalised, is computed in place in `monomials`, or in scratch space if not requested
+    std::vector<Fr*> work(num_polys);
+    Fr* scratch_space = monomials.empty() ? get_scratch_space<Fr>(n * num_polys) : nullptr;
+    for (size_t k = 0; k < num_polys; ++k) {
+        work[k] = monomials.empty() ? scratch_space + k * n : monomials[k];
+    }
+
+    // Inverse FFT over small_domain, with the bit-reversal done while copying the input in
+    parallel_for(small_domain.num_threads, [&](size_t j) {
+        for (size_t i = (j * small_domain.thread_size); i < ((j + 1) * small_domain.thread_size); ++i) {
+            const size_t swap_index = reverse_bits((uint32_t)i, (uint32_t)small_domain.log2_size);
+            for (size_t k = 0; k < num_polys; ++k) {
+                work[k][i] = lagrange[k][swap_index];
+            }
+        }
+    });
+    fft_batch_rounds<Fr>(work, small_domain, small_domain.get_inverse_round_roots(), 1);
+
+    // Normalise, scale coefficient i by g^i and replicate it into its bit-reversed block of the large FFT's input
+    const bool keep_monomials = !monomials.empty();
+    parallel_for(small_domain.num_threads, [&](size_t j) {
+        const size_t start = j * small_domain.thread_size;
+        const size_t end = (j + 1) * small_domain.thread_size;
+        Fr work_generator = large_domain.generator.pow(static_cast<uint64_t>(start));
+        if (!keep_monomials) {
+            work_generator *= small_domain.domain_inverse;
+        }
+        for (size_t i = start; i < end; ++i) {
+            const size_t block = extension * reverse_bits((uint32_t)i, (uint32_t)small_domain.log2_size);
+            for (size_t k = 0; k < num_polys; ++k) {
+                if (keep_monomials) {
+                    work[k][i] *= small_domain.domain_inverse;
+                }
+                const Fr value = work[k][i] * work_generator;
+                for (size_t l = 0; l < extension; ++l) {
+                    coset_evaluations[k][block + l] = value;
+                }
+            }
+            work_generator *= large_domain.generator;
+        }
+    });
+    fft_batch_rounds(coset_evaluations, large_domain, large_domain.get_round_roots(), extension);
+}
+
+template <typename Fr>
+void coset_lde_from_lagrange(const Fr* lagrange,
+                             Fr* coset_evaluations,
+                             Fr* monomial,
+                             const EvaluationDomain<Fr>& small_domain,
+                             const EvaluationDomain<Fr>& large_domain)
+{
+    coset_lde_from_lagrange<Fr>({ &lagrange, 1 },
+                                { &coset_evaluations, 1 },
+                                monomial == nullptr ? std::span<Fr* const>() : std::span<Fr* const>(&monomial, 1),
+                                small_domain,
+                                large_domain);
+}
+
 template <typename Fr> void fft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value)
 {
     fft_inner_parallel({ coeffs }, domain, domain.root, domain.get_round_roots());
@@ -649,10 +878,7 @@ void coset_fft(Fr* coeffs,
     }
 
     if (domain_extension == 4) {
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-        for (size_t j = 0; j < domain.num_threads; ++j) {
+        parallel_for(domain.num_threads, [&](size_t j) {
             const size_t start = j * domain.thread_size;
             const size_t end = (j + 1) * domain.thread_size;
             for (size_t i = start; i < end; ++i) {
@@ -661,7 +887,7 @@ void coset_fft(Fr* coeffs,
                 Fr::__copy(scratch_space[i + (2UL << domain.log2_size)], coeffs[(i << 2UL) + 2UL]);
                 Fr::__copy(scratch_space[i + (3UL << domain.log2_size)], coeffs[(i << 2UL) + 3UL]);
             }
-        }
+        });
         for (size_t i = 0; i < domain.size; ++i) {
             for (size_t j = 0; j < domain_extension; ++j) {
                 Fr::__copy(scratch_space[i + (j << domain.log2_size)], coeffs[(i << log2_domain_extension) + j]);
@@ -747,18 +973,11 @@ void mul(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationD
 
 template <typename Fr> Fr evaluate(const Fr* coeffs, const Fr& z, const size_t n)
 {
-#ifndef NO_MULTITHREADING
     size_t num_threads = max_threads::compute_num_threads();
-#else
-    size_t num_threads = 1;
-#endif
     size_t range_per_thread = n / num_threads;
     size_t leftovers = n - (range_per_thread * num_threads);
     Fr* evaluations = new Fr[num_threads];
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t j = 0; j < num_threads; ++j) {
+    parallel_for(num_threads, [&](size_t j) {
         Fr z_acc = z.pow(static_cast<uint64_t>(j * range_per_thread));
         size_t offset = j * range_per_thread;
         evaluations[j] = Fr::zero();
@@ -768,7 +987,7 @@ template <typename Fr> Fr evaluate(const Fr* coeffs, const Fr& z, const size_t n
             evaluations[j] += work_var;
             z_acc *= z;
         }
-    }
+    });
 
     Fr r = Fr::zero();
     for (size_t j = 0; j < num_threads; ++j) {
@@ -784,18 +1003,11 @@ template <typename Fr> Fr evaluate(const std::vector<Fr*> coeffs, const Fr& z, c
     const size_t poly_size = large_n / num_polys;
     ASSERT(is_power_of_two(poly_size));
     const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
-#ifndef NO_MULTITHREADING
     size_t num_threads = max_threads::compute_num_threads();
-#else
-    size_t num_threads = 1;
-#endif
     size_t range_per_thread = large_n / num_threads;
     size_t leftovers = large_n - (range_per_thread * num_threads);
     Fr* evaluations = new Fr[num_threads];
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t j = 0; j < num_threads; ++j) {
+    parallel_for(num_threads, [&](size_t j) {
         Fr z_acc = z.pow(static_cast<uint64_t>(j * range_per_thread));
         size_t offset = j * range_per_thread;
         evaluations[j] = Fr::zero();
@@ -805,7 +1017,7 @@ template <typename Fr> Fr evaluate(const std::vector<Fr*> coeffs, const Fr& z, c
             evaluations[j] += work_var;
             z_acc *= z;
         }
-    }
+    });
 
     Fr r = Fr::zero();
     for (size_t j = 0; j < num_threads; ++j) {
@@ -815,6 +1027,71 @@ template <typename Fr> Fr evaluate(const std::vector<Fr*> coeffs, const Fr& z, c
     return r;
 }
 
+template <typename Fr>
+std::vector<Fr> batch_evaluate(std::span<const Fr* const> polynomials,
+                               const size_t n,
+                               std::span<const Fr> points,
+                               std::span<const uint64_t> point_masks)
+{
+    // Small enough that the powers of a couple of points and a block of each polynomial stay in L1
+    constexpr size_t BLOCK_SIZE = 256;
+
+    const size_t num_polynomials = polynomials.size();
+    const size_t num_points = points.size();
+    ASSERT(num_points <= 64);
+    ASSERT(point_masks.empty() || point_masks.size() == num_polynomials);
+    const uint64_t all_points = num_points == 64 ? ~0ULL : (1ULL << num_points) - 1;
+
+    const size_t num_evaluations = num_polynomials * num_points;
+    const size_t num_threads = max_threads::compute_num_threads();
+    const size_t range_per_thread = (n + num_threads - 1) / num_threads;
+    std::vector<Fr> thread_evaluations(num_threads * num_evaluations, Fr::zero());
+    parallel_for(num_threads, [&](size_t thread) {
+        const size_t start = std::min(thread * range_per_thread, n);
+        const size_t end = std::min(start + range_per_thread, n);
+        Fr* evaluations = &thread_evaluations[thread * num_evaluations];
+
+        // powers[j * BLOCK_SIZE + t] = points[j]^(block_start + t)
+        std::vector<Fr> powers(num_points * BLOCK_SIZE);
+        std::vector<Fr> next_powers(num_points);
+        for (size_t j = 0; j < num_points; ++j) {
+            next_powers[j] = points[j].pow(static_cast<uint64_t>(start));
+        }
+        for (size_t block_start = start; block_start < end; block_start += BLOCK_SIZE) {
+            const size_t block_size = std::min(BLOCK_SIZE, end - block_start);
+            for (size_t j = 0; j < num_points; ++j) {
+                for (size_t t = 0; t < block_size; ++t) {
+                    powers[j * BLOCK_SIZE + t] = next_powers[j];
+                    next_powers[j] *= points[j];
+                }
+            }
+            for (size_t i = 0; i < num_polynomials; ++i) {
+                const Fr* coefficients = polynomials[i] + block_start;
+                const uint64_t mask = point_masks.empty() ? all_points : point_masks[i];
+                for (size_t j = 0; j < num_points; ++j) {
+                    if (((mask >> j) & 1) == 0) {
+                        continue;
+                    }
+                    const Fr* point_powers = &powers[j * BLOCK_SIZE];
+                    Fr sum = Fr::zero();
+                    for (size_t t = 0; t < block_size; ++t) {
+                        sum += coefficients[t] * point_powers[t];
+                    }
+                    evaluations[i * num_points + j] += sum;
+                }
+            }
+        }
+    });
+
+    std::vector<Fr> evaluations(num_evaluations, Fr::zero());
+    for (size_t thread = 0; thread < num_threads; ++thread) {
+        for (size_t k = 0; k < num_evaluations; ++k) {
+            evaluations[k] += thread_evaluations[thread * num_evaluations + k];
+        }
+    }
+    return evaluations;
+}
+
 /**
  * @brief Compute evaluations of lagrange polynomial L_1(X) on the specified domain
  *
@@ -857,11 +1134,8 @@ void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
     // Step 1: Compute the 1/denominator for each evaluation: 1 / (X_i - 1)
     Fr multiplicand = target_domain.root; // kn'th root of unity w'
 
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
     // First compute X_i - 1, i = 0,...,kn-1
-    for (size_t j = 0; j < target_domain.num_threads; ++j) {
+    parallel_for(target_domain.num_threads, [&](size_t j) {
         const Fr root_shift = multiplicand.pow(static_cast<uint64_t>(j * target_domain.thread_size));
         Fr work_root = src_domain.generator * root_shift; // g.(w')^{j*thread_size}
         size_t offset = j * target_domain.thread_size;
@@ -869,7 +1143,7 @@ void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
             l_1_coefficients[i] = work_root - Fr::one(); // (w')^{j*thread_size + i}.g - 1
             work_root *= multiplicand;                   // (w')^{j*thread_size + i + 1}
         }
-    }
+    });
 
     // Compute 1/(X_i - 1) using Montgomery batch inversion
     Fr::batch_invert(l_1_coefficients, target_domain.size);
@@ -890,15 +1164,12 @@ void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
     // Step 3: Construct L_1(X_i) by multiplying the 1/denominator evaluations in
     // l_1_coefficients by the numerator evaluations in subgroup_roots
     size_t subgroup_mask = subgroup_size - 1;
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < target_domain.num_threads; ++i) {
+    parallel_for(target_domain.num_threads, [&](size_t i) {
         for (size_t j = 0; j < target_domain.thread_size; ++j) {
             size_t eval_idx = i * target_domain.thread_size + j;
             l_1_coefficients[eval_idx] *= subgroup_roots[eval_idx & subgroup_mask];
         }
-    }
+    });
     delete[] subgroup_roots;
 }
 
@@ -989,10 +1260,7 @@ void divide_by_pseudo_vanishing_polynomial(std::vector<Fr*> coeffs,
             }
         }
     } else {
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-        for (size_t k = 0; k < target_domain.num_threads; ++k) {
+        parallel_for(target_domain.num_threads, [&](size_t k) {
             size_t offset = k * target_domain.thread_size;
             const Fr root_shift = target_domain.root.pow(static_cast<uint64_t>(offset));
             Fr work_root = src_domain.generator * root_shift;
@@ -1009,11 +1277,90 @@ void divide_by_pseudo_vanishing_polynomial(std::vector<Fr*> coeffs,
                     work_root *= target_domain.root;
                 }
             }
-        }
+        });
     }
     delete[] subgroup_roots;
 }
 
+template <typename Fr>
+void divide_by_linear_factors(std::span<Fr* const> polynomials, const size_t n, std::span<const Fr> roots)
+{
+    // Below this many coefficients per block, the extra multiplications of the carry correction outweigh the threads
+    constexpr size_t MIN_BLOCK_SIZE = 1UL << 12;
+
+    const size_t num_polynomials = polynomials.size();
+    const size_t num_roots = roots.size();
+    if (n == 0 || num_polynomials == 0 || num_roots == 0) {
+        return;
+    }
+
+    // bᵢ = (aᵢ − bᵢ₋₁)⋅dⱼ = dⱼ⋅aᵢ + gⱼ⋅bᵢ₋₁ where dⱼ = (−rⱼ)⁻¹ and gⱼ = −dⱼ
+    std::vector<Fr> divisors(roots.begin(), roots.end());
+    for (auto& divisor : divisors) {
+        divisor = -divisor;
+    }
+    Fr::batch_invert(divisors);
+
+    const size_t num_blocks = std::clamp<size_t>(n / MIN_BLOCK_SIZE, 1, max_threads::compute_num_threads());
+    const size_t block_size = (n + num_blocks - 1) / num_blocks;
+    const size_t num_tasks = num_polynomials * num_blocks;
+
+    // For polynomial k and block b, entry k * num_blocks + b holds the local bᵢ at the end of the block, then the true
+    // bᵢ just before the block once the scan has run
+    std::vector<Fr> block_ends(num_tasks);
+    std::vector<Fr> carries(num_tasks, Fr::zero());
+
+    // Pass j divides by root j (if j < num_roots) after correcting the division by root j - 1 (if j > 0)
+    for (size_t j = 0; j <= num_roots; ++j) {
+        const bool divide = j < num_roots;
+        const bool correct = j > 0 && num_blocks > 1;
+        if (!divide && !correct) {
+            break;
+        }
+        parallel_for(num_tasks, [&](size_t task) {
+            Fr* coefficients = polynomials[task / num_blocks];
+            const size_t block = task % num_blocks;
+            const size_t start = std::min(block * block_size, n);
+            const size_t end = std::min(start + block_size, n);
+
+            const Fr carry = carries[task];
+            const Fr multiplier = correct ? -divisors[j - 1] : Fr::zero();
+            Fr multiplier_power = Fr::one();
+            // Block 0 starts from b₋₁ = 0, so its local values are already the true ones
+            const bool correct_block = correct && block > 0;
+            Fr temp = Fr::zero();
+            for (size_t i = start; i < end; ++i) {
+                Fr coefficient = coefficients[i];
+                if (correct_block) {
+                    multiplier_power *= multiplier;
+                    coefficient += multiplier_power * carry;
+                }
+                if (divide) {
+                    temp = coefficient - temp;
+                    temp *= divisors[j];
+                    coefficient = temp;
+                }
+                coefficients[i] = coefficient;
+            }
+            block_ends[task] = temp;
+        });
+
+        if (divide && num_blocks > 1) {
+            // Serial scan over the blocks: the true bᵢ at the end of a block is its local value plus g^block_size times
+            // the true value before it
+            const Fr block_multiplier = (-divisors[j]).pow(static_cast<uint64_t>(block_size));
+            for (size_t k = 0; k < num_polynomials; ++k) {
+                Fr carry = Fr::zero();
+                for (size_t block = 0; block < num_blocks; ++block) {
+                    const size_t task = k * num_blocks + block;
+                    carries[task] = carry;
+                    carry = block_ends[task] + block_multiplier * carry;
+                }
+            }
+        }
+    }
+}
+
 template <typename Fr> Fr compute_kate_opening_coefficients(const Fr* src, Fr* dest, const Fr& z, const size_t n)
 {
     // if `coeffs` represents F(X), we want to compute W(X)
@@ -1024,17 +1371,11 @@ template <typename Fr> Fr compute_kate_opening_coefficients(const Fr* src, Fr* d
     // Under these conditions we can perform this polynomial division in linear time with good constants
     Fr f = evaluate(src, z, n);
 
-    // compute (1 / -z)
-    Fr divisor = -z.invert();
-
-    // we're about to shove these coefficients into a pippenger multi-exponentiation routine, where we need
-    // to convert out of montgomery form. So, we can use lazy reduction techniques here without triggering overflows
-    dest[0] = src[0] - f;
-    dest[0] *= divisor;
-    for (size_t i = 1; i < n; ++i) {
-        dest[i] = src[i] - dest[i - 1];
-        dest[i] *= divisor;
+    if (src != dest) {
+        copy_polynomial(src, dest, n, n);
     }
+    dest[0] -= f;
+    divide_by_linear_factors<Fr>(std::span{ &dest, 1 }, n, std::span{ &z, 1 });
 
     return f;
 }
@@ -1365,12 +1706,26 @@ void compute_efficient_interpolation(const Fr* src, Fr* dest, const Fr* evaluati
 
 template fr evaluate<fr>(const fr*, const fr&, const size_t);
 template fr evaluate<fr>(const std::vector<fr*>, const fr&, const size_t);
+template std::vector<fr> batch_evaluate<fr>(std::span<const fr* const>,
+                                            const size_t,
+                                            std::span<const fr>,
+                                            std::span<const uint64_t>);
 template void copy_polynomial<fr>(const fr*, fr*, size_t, size_t);
 template void fft_inner_serial<fr>(std::vector<fr*>, const size_t, const std::vector<fr*>&);
 template void fft_inner_parallel<fr>(std::vector<fr*>, const EvaluationDomain<fr>&, const fr&, const std::vector<fr*>&);
 template void fft<fr>(fr*, const EvaluationDomain<fr>&);
 template void fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 template void fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+template void fft_batch<fr>(std::span<fr* const>, const EvaluationDomain<fr>&);
+template void ifft_batch<fr>(std::span<fr* const>, const EvaluationDomain<fr>&);
+template void coset_fft_batch<fr>(std::span<fr* const>, const EvaluationDomain<fr>&);
+template void coset_lde_from_lagrange<fr>(std::span<const fr* const>,
+                                          std::span<fr* const>,
+                                          std::span<fr* const>,
+                                          const EvaluationDomain<fr>&,
+                                          const EvaluationDomain<fr>&);
+template void coset_lde_from_lagrange<fr>(
+    const fr*, fr*, fr*, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&);
 template void fft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
@@ -1396,6 +1751,7 @@ template void divide_by_pseudo_vanishing_polynomial<fr>(std::vector<fr*>,
                                                         const EvaluationDomain<fr>&,
                                                         const EvaluationDomain<fr>&,
                                                         const size_t);
+template void divide_by_linear_factors<fr>(std::span<fr* const>, const size_t, std::span<const fr>);
 template fr compute_kate_opening_coefficients<fr>(const fr*, fr*, const fr&, const size_t);
 template LagrangeEvaluations<fr> get_lagrange_evaluations<fr>(const fr&, const EvaluationDomain<fr>&, const size_t);
 template fr compute_barycentric_evaluation<fr>(const fr*, const size_t, const fr&, const EvaluationDomain<fr>&);
@@ -1411,6 +1767,10 @@ template void compute_efficient_interpolation<fr>(const fr*, fr*, const fr*, con
 
 template grumpkin::fr evaluate<grumpkin::fr>(const grumpkin::fr*, const grumpkin::fr&, const size_t);
 template grumpkin::fr evaluate<grumpkin::fr>(const std::vector<grumpkin::fr*>, const grumpkin::fr&, const size_t);
+template std::vector<grumpkin::fr> batch_evaluate<grumpkin::fr>(std::span<const grumpkin::fr* const>,
+                                                                const size_t,
+                                                                std::span<const grumpkin::fr>,
+                                                                std::span<const uint64_t>);
 template void copy_polynomial<grumpkin::fr>(const grumpkin::fr*, grumpkin::fr*, size_t, size_t);
 template void fft_inner_serial<grumpkin::fr>(std::vector<grumpkin::fr*>,
                                              const size_t,
@@ -1422,6 +1782,19 @@ template void fft_inner_parallel<grumpkin::fr>(std::vector<grumpkin::fr*>,
 template void fft<grumpkin::fr>(grumpkin::fr*, const EvaluationDomain<grumpkin::fr>&);
 template void fft<grumpkin::fr>(grumpkin::fr*, grumpkin::fr*, const EvaluationDomain<grumpkin::fr>&);
 template void fft<grumpkin::fr>(std::vector<grumpkin::fr*>, const EvaluationDomain<grumpkin::fr>&);
+template void fft_batch<grumpkin::fr>(std::span<grumpkin::fr* const>, const EvaluationDomain<grumpkin::fr>&);
+template void ifft_batch<grumpkin::fr>(std::span<grumpkin::fr* const>, const EvaluationDomain<grumpkin::fr>&);
+template void coset_fft_batch<grumpkin::fr>(std::span<grumpkin::fr* const>, const EvaluationDomain<grumpkin::fr>&);
+template void coset_lde_from_lagrange<grumpkin::fr>(std::span<const grumpkin::fr* const>,
+                                                    std::span<grumpkin::fr* const>,
+                                                    std::span<grumpkin::fr* const>,
+                                                    const EvaluationDomain<grumpkin::fr>&,
+                                                    const EvaluationDomain<grumpkin::fr>&);
+template void coset_lde_from_lagrange<grumpkin::fr>(const grumpkin::fr*,
+                                                    grumpkin::fr*,
+                                                    grumpkin::fr*,
+                                                    const EvaluationDomain<grumpkin::fr>&,
+                                                    const EvaluationDomain<grumpkin::fr>&);
 template void fft_with_constant<grumpkin::fr>(grumpkin::fr*,
                                               const EvaluationDomain<grumpkin::fr>&,
                                               const grumpkin::fr&);
@@ -1473,6 +1846,9 @@ template void divide_by_pseudo_vanishing_polynomial<grumpkin::fr>(std::vector<gr
                                                                   const EvaluationDomain<grumpkin::fr>&,
                                                                   const EvaluationDomain<grumpkin::fr>&,
                                                                   const size_t);
+template void divide_by_linear_factors<grumpkin::fr>(std::span<grumpkin::fr* const>,
+                                                     const size_t,
+                                                     std::span<const grumpkin::fr>);
 template grumpkin::fr compute_kate_opening_coefficients<grumpkin::fr>(const grumpkin::fr*,
                                                                       grumpkin::fr*,
                                                                       const grumpkin::fr&,
@@ -25,6 +25,16 @@ template <typename Fr> Fr evaluate(std::span<const Fr> coeffs, const Fr& z)
     return evaluate(coeffs, z, coeffs.size());
 };
 template <typename Fr> Fr evaluate(const std::vector<Fr*> coeffs, const Fr& z, const size_t large_n);
+
+// Evaluates each of the polynomials (n coefficients each) at each of the points in a single parallel pass. The powers
+// of the points are computed once per block of coefficients and shared by all the polynomials, which are read while
+// the block is still in cache. Polynomial i is only evaluated at the points whose bit is set in point_masks[i], or at
+// all of them if point_masks is empty. Returns evaluations[i * points.size() + j] = pᵢ(points[j]) (zero if skipped).
+template <typename Fr>
+std::vector<Fr> batch_evaluate(std::span<const Fr* const> polynomials,
+                               const size_t n,
+                               std::span<const Fr> points,
+                               std::span<const uint64_t> point_masks = {});
 template <typename Fr>
 void copy_polynomial(const Fr* src, Fr* dest, size_t num_src_coefficients, size_t num_target_coefficients);
 
@@ -40,6 +50,30 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
 template <typename Fr> void fft(Fr* coeffs, const EvaluationDomain<Fr>& domain);
 template <typename Fr> void fft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain);
 template <typename Fr> void fft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain);
+
+// Batched fft, ifft and coset_fft: every polynomial (domain.size coefficients each) is transformed in place in the same
+// sweep, so the roots of unity and the per-round thread barriers are shared by the whole batch.
+template <typename Fr> void fft_batch(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain);
+template <typename Fr> void ifft_batch(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain);
+template <typename Fr> void coset_fft_batch(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain);
+
+// Low-degree extension straight from Lagrange form: the evaluations over the coset of large_domain of polynomials given
+// as evaluations over small_domain, optionally also emitting their monomial form. Equivalent to ifft, zero-padding and
+// coset_fft, without the intermediate copy and without the FFT rounds that would only see the padding.
+template <typename Fr>
+void coset_lde_from_lagrange(std::span<const Fr* const> lagrange,
+                             std::span<Fr* const> coset_evaluations,
+                             std::span<Fr* const> monomials,
+                             const EvaluationDomain<Fr>& small_domain,
+                             const EvaluationDomain<Fr>& large_domain);
+// Single polynomial form; `monomial` may be null
+template <typename Fr>
+void coset_lde_from_lagrange(const Fr* lagrange,
+                             Fr* coset_evaluations,
+                             Fr* monomial,
+                             const EvaluationDomain<Fr>& small_domain,
+                             const EvaluationDomain<Fr>& large_domain);
+
 template <typename Fr> void fft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value);
 
 template <typename Fr> void coset_fft(Fr* coeffs, const EvaluationDomain<Fr>& domain);
@@ -156,6 +190,20 @@ template <typename Fr> void compute_interpolation(const Fr* src, Fr* dest, const
 template <typename Fr>
 void compute_efficient_interpolation(const Fr* src, Fr* dest, const Fr* evaluation_points, const size_t n);
 
+/**
+ * @brief Divides each of the polynomials p(X) = ∑ᵢⁿ⁻¹ aᵢ⋅Xⁱ by (X−r₁)⋯(X−rₘ) in-place, using every thread.
+ *
+ * @details Assumes that every rⱼ is non-zero. Each root is divided out with the recurrence bᵢ = (aᵢ − bᵢ₋₁)⋅(−r)⁻¹
+ * over all n coefficients, and the field elements produced are exactly those of running it serially: when rⱼ divides
+ * p(X) the quotient is left in the low n−m coefficients and the top m are zero.
+ *
+ * The recurrence is linear, so it parallelises as a blocked scan. Every block is divided on its own, as if bᵢ₋₁ were
+ * 0 at its start, which leaves it off by gᵗ⁺¹⋅c at offset t (g = −(−r)⁻¹, c the true value just before the block).
+ * The c of every block follows from a scan over the block ends, and the correction for root j is applied in the same
+ * sweep as the division by root j+1, so m roots take m+1 passes over the coefficients.
+ */
+template <typename Fr> void divide_by_linear_factors(std::span<Fr* const> polynomials, size_t n, std::span<const Fr> roots);
+
 /**
  * @brief Divides p(X) by (X-r) in-place.
  */
@@ -193,19 +241,9 @@ template <typename Fr> void factor_roots(std::span<Fr> polynomial, const Fr& roo
         // bₙ₋₂ = (aₙ₋₂ − bₙ₋₃)⋅(−r)⁻¹
         // bₙ₋₁ = 0
 
-        // For the simple case of one root we compute (−r)⁻¹ and
-        Fr root_inverse = (-root).invert();
-        // set b₋₁ = 0
-        Fr temp = 0;
-        // We start multiplying lower coefficient by the inverse and subtracting those from highter coefficients
         // Since (x - r) should divide the polynomial cleanly, we can guide division with lower coefficients
-        for (size_t i = 0; i < size - 1; ++i) {
-            // at the start of the loop, temp = bᵢ₋₁
-            // and we can compute bᵢ   = (aᵢ − bᵢ₋₁)⋅(−r)⁻¹
-            temp = (polynomial[i] - temp);
-            temp *= root_inverse;
-            polynomial[i] = temp;
-        }
+        Fr* coefficients = polynomial.data();
+        divide_by_linear_factors<Fr>(std::span{ &coefficients, 1 }, size - 1, std::span{ &root, 1 });
     }
     polynomial[size - 1] = Fr::zero();
 }
@@ -226,41 +264,27 @@ template <typename Fr> void factor_roots(std::span<Fr> polynomial, std::span<con
     if (roots.size() == 1) {
         factor_roots(polynomial, roots[0]);
     } else {
-        // For division by several roots at once we need cache.
-        // Let's say we are dividing a₀, a₁, a₂, ... by (r₀, r₁, r₂)
-        // What we need to compute are the inverses: ((-r₀)⁻¹, (-r₁)⁻¹,(-r₂)⁻¹)
-        // Then for a₀ we compute:
-        //      a₀'   = a₀   * (-r₀)⁻¹
-        //      a₀''  = a₀'  * (-r₁)⁻¹
-        //      a₀''' = a₀'' * (-r₂)⁻¹
-        // a₀''' is the lowest coefficient of the resulting polynomial
-        // For a₁ we compute:
-        //      a₁'   = (a₁   - a₀')   * (-r₀)⁻¹
-        //      a₁''  = (a₁'  - a₀'')  * (-r₁)⁻¹
-        //      a₁''' = (a₁'' - a₀''') * (-r₂)⁻¹
-        // a₁''' is the second lowest coefficient of the resulting polynomial
-        // As you see, we only need the intermediate results of the previous round in addition to inversed roots and the
-        // original coefficient to calculate the resulting monomial coefficient. If we cache these results, we don't
-        // have to do several passes over the polynomial
+        // Dividing a₀, a₁, a₂, ... by (r₀, r₁, r₂) amounts to dividing by (X−r₀), then the result by (X−r₁), then by
+        // (X−r₂). Zero roots only shift the coefficients, the others are divided out by divide_by_linear_factors.
 
         const size_t num_roots = roots.size();
         ASSERT(num_roots < size);
         const size_t new_size = size - num_roots;
 
-        std::vector<Fr> minus_root_inverses;
-        minus_root_inverses.reserve(num_roots);
+        std::vector<Fr> non_zero_roots;
+        non_zero_roots.reserve(num_roots);
 
         // after the loop, this iterator points to the start of the polynomial
         // after having divided by all zero roots.
         size_t num_zero_roots{ 0 };
-        // Compute negated root inverses, and skip the 0 root
+        // Skip the 0 roots
         for (const auto& root : roots) {
             if (root.is_zero()) {
                 // if one of the roots is zero, then the first coefficient must be as well
                 // so we need to start the iteration from the second coefficient on-wards
                 ++num_zero_roots;
             } else {
-                minus_root_inverses.emplace_back(-root);
+                non_zero_roots.emplace_back(root);
             }
         }
         // If there are M zero roots, then the first M coefficients of polynomial must be zero
@@ -272,40 +296,16 @@ template <typename Fr> void factor_roots(std::span<Fr> polynomial, std::span<con
         // If there are no zeros, then zero_factored == polynomial
         auto zero_factored = polynomial.subspan(num_zero_roots);
 
-        const size_t num_non_zero_roots = minus_root_inverses.size();
-        if (num_non_zero_roots > 0) {
-            Fr::batch_invert(minus_root_inverses);
-
-            std::vector<Fr> division_cache;
-            division_cache.reserve(num_non_zero_roots);
-
-            // Compute the a₀', a₀'', a₀''' and put them in cache
-            Fr temp = zero_factored[0];
-            for (const auto& minus_root_inverse : minus_root_inverses) {
-                temp *= minus_root_inverse;
-                division_cache.emplace_back(temp);
-            }
-            // We already know the lower coefficient of the result
-            polynomial[0] = division_cache.back();
-
-            // Compute the resulting coefficients one by one
-            for (size_t i = 1; i < zero_factored.size() - num_non_zero_roots; i++) {
-                temp = zero_factored[i];
-                // Compute the intermediate values for the coefficient and save in cache
-                for (size_t j = 0; j < num_non_zero_roots; j++) {
-                    temp -= division_cache[j];
-                    temp *= minus_root_inverses[j];
-                    division_cache[j] = temp;
-                }
-                // Save the resulting coefficient
-                polynomial[i] = temp;
-            }
-        } else if (num_zero_roots > 0) {
+        if (!non_zero_roots.empty()) {
+            Fr* coefficients = zero_factored.data();
+            divide_by_linear_factors<Fr>(std::span{ &coefficients, 1 }, zero_factored.size(), non_zero_roots);
+        }
+        if (num_zero_roots > 0) {
             // if one of the roots is 0 after having divided by all other roots,
             // then p(X) = a₁⋅X + ⋯ + aₙ₋₁⋅Xⁿ⁻¹
             // so we shift the array of coefficients to the left
             // and the result is p(X) = a₁ + ⋯ + aₙ₋₁⋅Xⁿ⁻² and we subtract 1 from the size.
-            std::copy_n(zero_factored.begin(), zero_factored.size(), polynomial.begin());
+            std::copy_n(zero_factored.begin(), new_size, polynomial.begin());
         }
 
         // Clear the last coefficients to prevent accidents
@@ -342,6 +342,16 @@ extern template void fft_inner_parallel<fr>(std::vector<fr*>,
 extern template void fft<fr>(fr*, const EvaluationDomain<fr>&);
 extern template void fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 extern template void fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+extern template void fft_batch<fr>(std::span<fr* const>, const EvaluationDomain<fr>&);
+extern template void ifft_batch<fr>(std::span<fr* const>, const EvaluationDomain<fr>&);
+extern template void coset_fft_batch<fr>(std::span<fr* const>, const EvaluationDomain<fr>&);
+extern template void coset_lde_from_lagrange<fr>(std::span<const fr* const>,
+                                                 std::span<fr* const>,
+                                                 std::span<fr* const>,
+                                                 const EvaluationDomain<fr>&,
+                                                 const EvaluationDomain<fr>&);
+extern template void coset_lde_from_lagrange<fr>(
+    const fr*, fr*, fr*, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&);
 extern template void fft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 extern template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&);
 extern template void coset_fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
@@ -401,6 +411,20 @@ extern template void fft_inner_parallel<grumpkin::fr>(std::vector<grumpkin::fr*>
 extern template void fft<grumpkin::fr>(grumpkin::fr*, const EvaluationDomain<grumpkin::fr>&);
 extern template void fft<grumpkin::fr>(grumpkin::fr*, grumpkin::fr*, const EvaluationDomain<grumpkin::fr>&);
 extern template void fft<grumpkin::fr>(std::vector<grumpkin::fr*>, const EvaluationDomain<grumpkin::fr>&);
+extern template void fft_batch<grumpkin::fr>(std::span<grumpkin::fr* const>, const EvaluationDomain<grumpkin::fr>&);
+extern template void ifft_batch<grumpkin::fr>(std::span<grumpkin::fr* const>, const EvaluationDomain<grumpkin::fr>&);
+extern template void coset_fft_batch<grumpkin::fr>(std::span<grumpkin::fr* const>,
+                                                   const EvaluationDomain<grumpkin::fr>&);
+extern template void coset_lde_from_lagrange<grumpkin::fr>(std::span<const grumpkin::fr* const>,
+                                                           std::span<grumpkin::fr* const>,
+                                                           std::span<grumpkin::fr* const>,
+                                                           const EvaluationDomain<grumpkin::fr>&,
+                                                           const EvaluationDomain<grumpkin::fr>&);
+extern template void coset_lde_from_lagrange<grumpkin::fr>(const grumpkin::fr*,
+                                                           grumpkin::fr*,
+                                                           grumpkin::fr*,
+                                                           const EvaluationDomain<grumpkin::fr>&,
+                                                           const EvaluationDomain<grumpkin::fr>&);
 extern template void fft_with_constant<grumpkin::fr>(grumpkin::fr*,
                                                      const EvaluationDomain<grumpkin::fr>&,
                                                      const grumpkin::fr&);
@@ -153,6 +153,107 @@ TEST(polynomials, basic_fft)
     aligned_free(data);
 }
 
+TEST(polynomials, fft_batch_matches_fft)
+{
+    constexpr size_t n = 1 << 10;
+    constexpr size_t num_polynomials = 3;
+    evaluation_domain domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+
+    std::vector<polynomial> polynomials;
+    std::vector<fr*> coefficients;
+    for (size_t k = 0; k < num_polynomials; ++k) {
+        polynomial poly(n);
+        const fr seed = fr::random_element();
+        poly[0] = seed;
+        for (size_t i = 1; i < n; ++i) {
+            poly[i] = poly[i - 1] * seed + fr(i);
+        }
+        polynomials.emplace_back(std::move(poly));
+        coefficients.emplace_back(polynomials.back().data());
+    }
+
+    const auto check = [&](auto batch_transform, auto transform) {
+        std::vector<polynomial> expected;
+        for (auto& poly : polynomials) {
+            expected.emplace_back(poly);
+            transform(expected.back().data(), domain);
+        }
+        batch_transform(coefficients, domain);
+        for (size_t k = 0; k < num_polynomials; ++k) {
+            EXPECT_EQ(polynomials[k], expected[k]) << k;
+        }
+    };
+    check(polynomial_arithmetic::fft_batch<fr>,
+          [](fr* coeffs, auto& domain) { polynomial_arithmetic::fft(coeffs, domain); });
+    check(polynomial_arithmetic::ifft_batch<fr>,
+          [](fr* coeffs, auto& domain) { polynomial_arithmetic::ifft(coeffs, domain); });
+    check(polynomial_arithmetic::coset_fft_batch<fr>,
+          [](fr* coeffs, auto& domain) { polynomial_arithmetic::coset_fft(coeffs, domain); });
+}
+
+TEST(polynomials, coset_lde_from_lagrange)
+{
+    constexpr size_t n = 1 << 10;
+    constexpr size_t num_polynomials = 2;
+    evaluation_domain small_domain = evaluation_domain(n);
+    evaluation_domain large_domain = evaluation_domain(4 * n);
+    small_domain.compute_lookup_table();
+    large_domain.compute_lookup_table();
+
+    std::vector<polynomial> lagrange;
+    for (size_t k = 0; k < num_polynomials; ++k) {
+        polynomial poly(n);
+        const fr seed = fr::random_element();
+        poly[0] = seed;
+        for (size_t i = 1; i < n; ++i) {
+            poly[i] = poly[i - 1] * seed + fr(i);
+        }
+        lagrange.emplace_back(std::move(poly));
+    }
+
+    std::vector<polynomial> expected_monomials;
+    std::vector<polynomial> expected_ffts;
+    for (auto& poly : lagrange) {
+        expected_monomials.emplace_back(n);
+        polynomial_arithmetic::ifft(poly.data(), expected_monomials.back().data(), small_domain);
+        expected_ffts.emplace_back(expected_monomials.back(), 4 * n);
+        polynomial_arithmetic::coset_fft(expected_ffts.back().data(), large_domain);
+    }
+
+    std::vector<const fr*> lagrange_coefficients;
+    std::vector<polynomial> monomials;
+    std::vector<polynomial> ffts;
+    std::vector<fr*> monomial_coefficients;
+    std::vector<fr*> fft_coefficients;
+    monomials.reserve(num_polynomials);
+    ffts.reserve(num_polynomials);
+    for (size_t k = 0; k < num_polynomials; ++k) {
+        lagrange_coefficients.emplace_back(lagrange[k].data());
+        monomials.emplace_back(n);
+        ffts.emplace_back(4 * n);
+        monomial_coefficients.emplace_back(monomials.back().data());
+        fft_coefficients.emplace_back(ffts.back().data());
+    }
+
+    polynomial_arithmetic::coset_lde_from_lagrange<fr>(
+        lagrange_coefficients, fft_coefficients, monomial_coefficients, small_domain, large_domain);
+    for (size_t k = 0; k < num_polynomials; ++k) {
+        EXPECT_EQ(monomials[k], expected_monomials[k]) << k;
+        EXPECT_EQ(ffts[k], expected_ffts[k]) << k;
+    }
+
+    // Without the monomial form
+    for (auto& poly : ffts) {
+        std::fill(poly.begin(), poly.end(), fr::zero());
+    }
+    polynomial_arithmetic::coset_lde_from_lagrange<fr>(
+        lagrange_coefficients, fft_coefficients, {}, small_domain, large_domain);
+    for (size_t k = 0; k < num_polynomials; ++k) {
+        EXPECT_EQ(ffts[k], expected_ffts[k]) << k;
+    }
+}
+
 TEST(polynomials, fft_ifft_consistency)
 {
     constexpr size_t n = 256;
@@ -1131,6 +1232,84 @@ TEST(polynomials, factor_roots)
     test_case(3, 6);
 }
 
+TEST(polynomials, divide_by_linear_factors)
+{
+    // Large enough to be split into several blocks when there are several threads, and not a multiple of the block size
+    constexpr size_t n = (1UL << 14) + 17;
+    constexpr size_t num_polynomials = 3;
+    constexpr size_t num_roots = 3;
+
+    std::vector<fr> roots(num_roots);
+    for (auto& root : roots) {
+        root = fr::random_element();
+    }
+    std::vector<polynomial> polynomials;
+    std::vector<polynomial> expected;
+    for (size_t k = 0; k < num_polynomials; ++k) {
+        polynomial poly(n);
+        const fr seed = fr::random_element();
+        poly[0] = seed;
+        for (size_t i = 1; i < n; ++i) {
+            poly[i] = poly[i - 1] * seed + fr(i);
+        }
+        polynomials.emplace_back(poly);
+
+        // The serial recurrence, one root at a time
+        for (const auto& root : roots) {
+            const fr divisor = (-root).invert();
+            fr temp = 0;
+            for (size_t i = 0; i < n; ++i) {
+                temp = (poly[i] - temp) * divisor;
+                poly[i] = temp;
+            }
+        }
+        expected.emplace_back(poly);
+    }
+
+    std::vector<fr*> coefficients;
+    for (auto& poly : polynomials) {
+        coefficients.emplace_back(poly.data());
+    }
+    polynomial_arithmetic::divide_by_linear_factors<fr>(coefficients, n, roots);
+
+    for (size_t k = 0; k < num_polynomials; ++k) {
+        EXPECT_EQ(polynomials[k], expected[k]) << k;
+    }
+}
+
+TEST(polynomials, batch_evaluate)
+{
+    constexpr size_t n = 1000;
+    constexpr size_t num_polynomials = 5;
+    const std::vector<fr> points{ fr::random_element(), fr::random_element(), fr::random_element() };
+
+    std::vector<polynomial> polynomials;
+    std::vector<const fr*> coefficients;
+    std::vector<uint64_t> point_masks;
+    for (size_t i = 0; i < num_polynomials; ++i) {
+        polynomial poly(n);
+        const fr seed = fr::random_element();
+        poly[0] = seed;
+        for (size_t k = 1; k < n; ++k) {
+            poly[k] = poly[k - 1] * seed + fr(k);
+        }
+        polynomials.emplace_back(std::move(poly));
+        coefficients.emplace_back(polynomials.back().data());
+        point_masks.emplace_back(i % 2 == 0 ? 0b111 : 0b010);
+    }
+
+    const auto evaluations = polynomial_arithmetic::batch_evaluate<fr>(coefficients, n, points);
+    const auto masked_evaluations = polynomial_arithmetic::batch_evaluate<fr>(coefficients, n, points, point_masks);
+    for (size_t i = 0; i < num_polynomials; ++i) {
+        for (size_t j = 0; j < points.size(); ++j) {
+            const fr expected = polynomial_arithmetic::evaluate(coefficients[i], points[j], n);
+            EXPECT_EQ(evaluations[i * points.size() + j], expected);
+            const bool requested = ((point_masks[i] >> j) & 1) == 1;
+            EXPECT_EQ(masked_evaluations[i * points.size() + j], requested ? expected : fr::zero());
+        }
+    }
+}
+
 TEST(polynomials, move_construct_and_assign)
 {
     // construct a poly with some arbitrary data
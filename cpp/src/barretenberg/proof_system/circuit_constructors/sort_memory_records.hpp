@@ -0,0 +1,104 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/max_threads.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace proof_system {
+
+/**
+ * @brief Sort the records of a ROM/RAM transcript into (index, timestamp) order
+ *
+ * @details Records are appended to a memory transcript in access order, i.e. with strictly increasing timestamps, so a
+ * *stable* sort on the cell index alone yields the order the sorted-list gates need. Cell indices are bounded by the
+ * size of the array, which lets us use a counting sort: O(num_records + num_cells) instead of O(n log n) comparisons.
+ *
+ * Large transcripts are split into one contiguous chunk per thread. Every thread histograms its own chunk, the
+ * histograms are prefix-summed index-major/thread-major, and every thread then scatters its chunk behind the chunks of
+ * lower-numbered threads in each bucket, which keeps the sort stable.
+ *
+ * @tparam Record RomRecord or RamRecord (anything with a `uint32_t index` member)
+ * @param records The transcript records. Overwritten with the sorted records
+ * @param num_cells Size of the memory array; every record index must be smaller than this
+ */
+template <typename Record> void sort_memory_records(std::vector<Record>& records, const size_t num_cells)
+{
+    const size_t num_records = records.size();
+    if (num_records < 2) {
+        return;
+    }
+
+    // Each thread needs its own histogram of `num_cells` counters, so only split when there are enough records to
+    // amortise that
+    constexpr size_t MIN_RECORDS_PER_THREAD = 1UL << 12;
+    size_t num_threads = max_threads::compute_num_threads();
+    while (num_threads > 1 &&
+           (num_records < num_threads * MIN_RECORDS_PER_THREAD || num_cells * num_threads > num_records)) {
+        num_threads >>= 1;
+    }
+    const size_t chunk_size = (num_records + num_threads - 1) / num_threads;
+
+    // bucket_offsets[thread * num_cells + index] holds the number of records in the thread's chunk with that index,
+    // and after the prefix sum the position at which the thread writes its next record with that index
+    std::vector<size_t> bucket_offsets(num_threads * num_cells, 0);
+
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for num_threads(num_threads)
+#endif
+    for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        const size_t start = thread_idx * chunk_size;
+        const size_t end = std::min(start + chunk_size, num_records);
+        size_t* counts = &bucket_offsets[thread_idx * num_cells];
+        for (size_t i = start; i < end; ++i) {
+            ASSERT(records[i].index < num_cells);
+            ++counts[records[i].index];
+        }
+    }
+
+    size_t offset = 0;
+    for (size_t index = 0; index < num_cells; ++index) {
+        for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            size_t& bucket = bucket_offsets[thread_idx * num_cells + index];
+            const size_t count = bucket;
+            bucket = offset;
+            offset += count;
+        }
+    }
+
+    std::vector<Record> sorted_records(num_records);
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for num_threads(num_threads)
+#endif
+    for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        const size_t start = thread_idx * chunk_size;
+        const size_t end = std::min(start + chunk_size, num_records);
+        size_t* offsets = &bucket_offsets[thread_idx * num_cells];
+        for (size_t i = start; i < end; ++i) {
+            sorted_records[offsets[records[i].index]++] = records[i];
+        }
+    }
+    records.swap(sorted_records);
+}
+
+/**
+ * @brief Sort a transcript whose first `num_presorted` records are already sorted
+ *
+ * @details process_{ROM,RAM}_arrays presort every transcript in parallel before the (inherently sequential) gate
+ * construction. Filling in uninitialized cells then appends records in increasing index order, each at an index no
+ * other record touches, so a linear merge restores the full order. Falls back to a full sort if the prefix turns out
+ * not to be sorted.
+ */
+template <typename Record>
+void sort_memory_records(std::vector<Record>& records, const size_t num_cells, const size_t num_presorted)
+{
+    const auto presorted_end = records.begin() + static_cast<std::ptrdiff_t>(num_presorted);
+    if (std::is_sorted(records.begin(), presorted_end) && std::is_sorted(presorted_end, records.end())) {
+        std::inplace_merge(records.begin(), presorted_end, records.end());
+    } else {
+        sort_memory_records(records, num_cells);
+    }
+}
+
+} // namespace proof_system
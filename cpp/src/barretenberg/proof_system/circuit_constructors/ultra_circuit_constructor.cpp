@@ -8,7 +8,11 @@
  *
  */
 #include "ultra_circuit_constructor.hpp"
+#include "sort_memory_records.hpp"
 #include <barretenberg/plonk/proof_system/constants.hpp>
+#include "barretenberg/common/thread.hpp"
+#include <atomic>
+#include <mutex>
 #include <unordered_set>
 #include <unordered_map>
 
@@ -2253,17 +2257,16 @@ void UltraCircuitConstructor::process_ROM_array(const size_t rom_id, const size_
     create_tag(sorted_list_tag, read_tag);
 
     // Make sure that every cell has been initialized
+    const size_t num_presorted = rom_array.records.size();
     for (size_t i = 0; i < rom_array.state.size(); ++i) {
         if (rom_array.state[i][0] == UNINITIALIZED_MEMORY_RECORD) {
             set_ROM_element_pair(rom_id, static_cast<uint32_t>(i), { zero_idx, zero_idx });
         }
     }
 
-#ifdef NO_TBB
-    std::sort(rom_array.records.begin(), rom_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, rom_array.records.begin(), rom_array.records.end());
-#endif
+    // The records added above for uninitialized cells are the only ones at their index, so they merge into the
+    // index order established by process_ROM_arrays
+    sort_memory_records(rom_array.records, rom_array.state.size(), num_presorted);
 
     for (const RomRecord& record : rom_array.records) {
         const auto index = record.index;
@@ -2341,17 +2344,16 @@ void UltraCircuitConstructor::process_RAM_array(const size_t ram_id, const size_
     // TODO: throw some kind of error here? Circuit should initialize all RAM elements to prevent errors.
     // e.g. if a RAM record is uninitialized but the index of that record is a function of public/private inputs,
     // different public iputs will produce different circuit constraints.
+    const size_t num_presorted = ram_array.records.size();
     for (size_t i = 0; i < ram_array.state.size(); ++i) {
         if (ram_array.state[i] == UNINITIALIZED_MEMORY_RECORD) {
             init_RAM_element(ram_id, static_cast<uint32_t>(i), zero_idx);
         }
     }
 
-#ifdef NO_TBB
-    std::sort(ram_array.records.begin(), ram_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, ram_array.records.begin(), ram_array.records.end());
-#endif
+    // The records added above for uninitialized cells are the only ones at their index, so they merge into the
+    // (index, timestamp) order established by process_RAM_arrays
+    sort_memory_records(ram_array.records, ram_array.state.size(), num_presorted);
 
     // Iterate over all but final RAM record.
     for (size_t i = 0; i < ram_array.records.size(); ++i) {
@@ -2468,12 +2470,28 @@ void UltraCircuitConstructor::process_RAM_array(const size_t ram_id, const size_
 
 void UltraCircuitConstructor::process_ROM_arrays(const size_t gate_offset_from_public_inputs)
 {
+    // Sorting the transcripts is independent across arrays, whereas the gates must be added one array at a time. Only
+    // split across arrays if there are several, so a single large array can use every thread for its own sort.
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for if (rom_arrays.size() > 1)
+#endif
+    for (size_t i = 0; i < rom_arrays.size(); ++i) {
+        sort_memory_records(rom_arrays[i].records, rom_arrays[i].state.size());
+    }
     for (size_t i = 0; i < rom_arrays.size(); ++i) {
         process_ROM_array(i, gate_offset_from_public_inputs);
     }
 }
 void UltraCircuitConstructor::process_RAM_arrays(const size_t gate_offset_from_public_inputs)
 {
+    // Sorting the transcripts is independent across arrays, whereas the gates must be added one array at a time. Only
+    // split across arrays if there are several, so a single large array can use every thread for its own sort.
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for if (ram_arrays.size() > 1)
+#endif
+    for (size_t i = 0; i < ram_arrays.size(); ++i) {
+        sort_memory_records(ram_arrays[i].records, ram_arrays[i].state.size());
+    }
     for (size_t i = 0; i < ram_arrays.size(); ++i) {
         process_RAM_array(i, gate_offset_from_public_inputs);
     }
@@ -3057,15 +3075,33 @@ inline fr UltraCircuitConstructor::compute_auxilary_identity(fr q_aux_value,
 /**
  * @brief Check that the circuit is correct in its current state
  *
- * @details The method switches the circuit to the "in-the-head" version, finalizes it, checks gates, lookups and
- * permutations and then switches it back from the in-the-head version, discarding the updates
+ * @details See check_circuit_with_failure_info()
  *
  * @return true
  * @return false
  */
 bool UltraCircuitConstructor::check_circuit()
 {
-    bool result = true;
+    return check_circuit_with_failure_info().passed;
+}
+
+/**
+ * @brief Check that the circuit is correct in its current state and, if it isn't, find the first gate that fails
+ *
+ * @details The method switches the circuit to the "in-the-head" version, finalizes it, checks gates, lookups and
+ * permutations and then switches it back from the in-the-head version, discarding the updates.
+ *
+ * Gates are checked in parallel, in chunks that threads claim in increasing order. With early exit, a thread stops at
+ * the first failing gate of its chunk and claims no chunks that start past the first failure found so far. Chunks
+ * before it are still checked in full, so the failure reported is always the lowest-indexed one. The tag products are
+ * only computed if all gates pass, also in parallel, counting every variable at its first occurrence in the wires.
+ *
+ * @param early_exit Whether to stop checking once the first failing gate is known, rather than count all of them
+ * @return CircuitCheckResult
+ */
+UltraCircuitConstructor::CircuitCheckResult UltraCircuitConstructor::check_circuit_with_failure_info(bool early_exit)
+{
+    CircuitCheckResult result;
     CircuitDataBackup circuit_backup = CircuitDataBackup::store_prefinilized_state(this);
     // Finalize circuit-in-the-head
 
@@ -3079,16 +3115,34 @@ bool UltraCircuitConstructor::check_circuit()
     const fr alpha = fr::random_element();
     const fr eta = fr::random_element();
 
-    // We need to get all memory
-    std::unordered_set<size_t> memory_read_record_gates;
-    std::unordered_set<size_t> memory_write_record_gates;
+    // We need to know which gates are memory records, as their 4th wire value is computed from the other three
+    enum MemoryRecordType : uint8_t { NONE, READ, WRITE };
+    std::vector<uint8_t> memory_record_types(num_gates + 1, NONE);
     for (const auto& gate_idx : memory_read_records) {
-        memory_read_record_gates.insert(gate_idx);
+        memory_record_types[gate_idx] = READ;
     }
     for (const auto& gate_idx : memory_write_records) {
-        memory_write_record_gates.insert(gate_idx);
+        memory_record_types[gate_idx] = WRITE;
     }
 
+    // Wire values of a gate as the prover sees them. Past the last gate (i.e. for the shifts of the last gate) they
+    // are zero
+    auto get_wire_values = [&](size_t gate) {
+        std::array<fr, 4> values{ fr::zero(), fr::zero(), fr::zero(), fr::zero() };
+        if (gate < num_gates) {
+            values = {
+                get_variable(w_l[gate]), get_variable(w_r[gate]), get_variable(w_o[gate]), get_variable(w_4[gate])
+            };
+        }
+        if (memory_record_types[gate] != NONE) {
+            values[3] = ((values[2] * eta + values[1]) * eta + values[0]) * eta;
+            if (memory_record_types[gate] == WRITE) {
+                values[3] += fr::one();
+            }
+        }
+        return values;
+    };
+
     // A hashing implementation for quick simulation lookups
     struct HashFrTuple {
         const barretenberg::fr mult_const = barretenberg::fr(uint256_t(0x1337, 0x1336, 0x1335, 0x1334));
@@ -3115,11 +3169,16 @@ bool UltraCircuitConstructor::check_circuit()
             return entry1 == entry2;
         }
     };
-    // The set of all lookup tuples that are in the tables
+    // The set of all lookup tuples that are in the tables. It is only read once built, so threads can share it
     std::unordered_set<std::tuple<barretenberg::fr, barretenberg::fr, barretenberg::fr, barretenberg::fr>,
                        HashFrTuple,
                        EqualFrTuple>
         table_hash;
+    size_t total_table_size = 0;
+    for (const auto& table : lookup_tables) {
+        total_table_size += table.size;
+    }
+    table_hash.reserve(total_table_size);
     // Prepare the lookup set for use in the circuit
     for (auto& table : lookup_tables) {
         const fr table_index(table.table_index);
@@ -3130,110 +3189,18 @@ bool UltraCircuitConstructor::check_circuit()
         }
     }
 
-    // We use a running tag product mechanism to ensure tag correctness
-    // This is the product of (value + γ ⋅ tag)
-    fr left_tag_product = fr::one();
-    // This is the product of (value + γ ⋅ tau[tag])
-    fr right_tag_product = fr::one();
-    // Randomness for the tag check
-    const fr tag_gamma = fr::random_element();
-    // We need to include each variable only once
-    std::unordered_set<size_t> encountered_variables;
-
-    // Function to quickly update tag products and encountered variable set by index and value
-    auto update_tag_check_information = [&](size_t variable_index, fr value) {
-        size_t real_index = real_variable_index[variable_index];
-        // Check to ensure that we are not including a variable twice
-        if (encountered_variables.contains(real_index)) {
-            return;
-        }
-        size_t tag_in = real_variable_tags[real_index];
-        if (tag_in != DUMMY_TAG) {
-            size_t tag_out = tau.at((uint32_t)tag_in);
-            left_tag_product *= value + tag_gamma * fr(tag_in);
-            right_tag_product *= value + tag_gamma * fr(tag_out);
-            encountered_variables.insert(real_index);
-        }
-    };
-    // For each gate
-    for (size_t i = 0; i < num_gates; i++) {
-        fr q_arith_value;
-        fr q_aux_value;
-        fr q_elliptic_value;
-        fr q_sort_value;
-        fr q_lookup_type_value;
-        fr q_1_value;
-        fr q_2_value;
-        fr q_3_value;
-        fr q_4_value;
-        fr q_m_value;
-        fr q_c_value;
-        fr w_1_value;
-        fr w_2_value;
-        fr w_3_value;
-        fr w_4_value;
-        fr w_4_index;
-        // Get the values of selectors and wires and update tag products along the way
-        q_arith_value = q_arith[i];
-        q_aux_value = q_aux[i];
-        q_elliptic_value = q_elliptic[i];
-        q_sort_value = q_sort[i];
-        q_lookup_type_value = q_lookup_type[i];
-        q_1_value = q_1[i];
-        q_2_value = q_2[i];
-        q_3_value = q_3[i];
-        q_4_value = q_4[i];
-        q_m_value = q_m[i];
-        q_c_value = q_c[i];
-        w_1_value = get_variable(w_l[i]);
-        update_tag_check_information(w_l[i], w_1_value);
-        w_2_value = get_variable(w_r[i]);
-        update_tag_check_information(w_r[i], w_2_value);
-        w_3_value = get_variable(w_o[i]);
-        update_tag_check_information(w_o[i], w_3_value);
-        w_4_value = get_variable(w_4[i]);
-        // We need to wait before updating tag product for w_4
-        w_4_index = w_4[i];
-
-        // If we are touching a gate with memory access, we need to update the value of the 4th witness
-        if (memory_read_record_gates.contains(i)) {
-            w_4_value = ((w_3_value * eta + w_2_value) * eta + w_1_value) * eta;
-        }
-        if (memory_write_record_gates.contains(i)) {
-            w_4_value = ((w_3_value * eta + w_2_value) * eta + w_1_value) * eta + fr::one();
-        }
-        // Now we can update the tag product for w_4
-        update_tag_check_information((uint32_t)w_4_index, w_4_value);
-        fr w_1_shifted_value;
-        fr w_2_shifted_value;
-        fr w_3_shifted_value;
-        fr w_4_shifted_value;
-        if (i < (num_gates - 1)) {
-
-            w_1_shifted_value = get_variable(w_l[i + 1]);
-            w_2_shifted_value = get_variable(w_r[i + 1]);
-            w_3_shifted_value = get_variable(w_o[i + 1]);
-            w_4_shifted_value = get_variable(w_4[i + 1]);
-        } else {
-            w_1_shifted_value = fr::zero();
-            w_2_shifted_value = fr::zero();
-            w_3_shifted_value = fr::zero();
-            w_4_shifted_value = fr::zero();
-        }
-        if (memory_read_record_gates.contains(i + 1)) {
-            w_4_shifted_value = ((w_3_shifted_value * eta + w_2_shifted_value) * eta + w_1_shifted_value) * eta;
-        }
-        if (memory_write_record_gates.contains(i + 1)) {
-            w_4_shifted_value =
-                ((w_3_shifted_value * eta + w_2_shifted_value) * eta + w_1_shifted_value) * eta + fr::one();
-        }
-        if (!compute_arithmetic_identity(q_arith_value,
-                                         q_1_value,
-                                         q_2_value,
-                                         q_3_value,
-                                         q_4_value,
-                                         q_m_value,
-                                         q_c_value,
+    // Returns the name of the first relation that fails at the gate, or nullptr if the gate satisfies all of them
+    auto check_gate = [&](size_t i) -> const char* {
+        const auto [w_1_value, w_2_value, w_3_value, w_4_value] = get_wire_values(i);
+        const auto [w_1_shifted_value, w_2_shifted_value, w_3_shifted_value, w_4_shifted_value] =
+            get_wire_values(i + 1);
+        if (!compute_arithmetic_identity(q_arith[i],
+                                         q_1[i],
+                                         q_2[i],
+                                         q_3[i],
+                                         q_4[i],
+                                         q_m[i],
+                                         q_c[i],
                                          w_1_value,
                                          w_2_value,
                                          w_3_value,
@@ -3243,20 +3210,16 @@ bool UltraCircuitConstructor::check_circuit()
                                          arithmetic_base,
                                          alpha)
                  .is_zero()) {
-#ifndef FUZZING
-            info("Arithemtic identity fails at gate ", i);
-#endif
-            result = false;
-            break;
+            return "arithmetic";
         }
-        if (!compute_auxilary_identity(q_aux_value,
-                                       q_arith_value,
-                                       q_1_value,
-                                       q_2_value,
-                                       q_3_value,
-                                       q_4_value,
-                                       q_m_value,
-                                       q_c_value,
+        if (!compute_auxilary_identity(q_aux[i],
+                                       q_arith[i],
+                                       q_1[i],
+                                       q_2[i],
+                                       q_3[i],
+                                       q_4[i],
+                                       q_m[i],
+                                       q_c[i],
                                        w_1_value,
                                        w_2_value,
                                        w_3_value,
@@ -3269,17 +3232,12 @@ bool UltraCircuitConstructor::check_circuit()
                                        alpha,
                                        eta)
                  .is_zero()) {
-#ifndef FUZZING
-            info("Auxilary identity fails at gate ", i);
-#endif
-
-            result = false;
-            break;
+            return "auxiliary";
         }
-        if (!compute_elliptic_identity(q_elliptic_value,
-                                       q_1_value,
-                                       q_3_value,
-                                       q_4_value,
+        if (!compute_elliptic_identity(q_elliptic[i],
+                                       q_1[i],
+                                       q_3[i],
+                                       q_4[i],
                                        w_2_value,
                                        w_3_value,
                                        w_1_shifted_value,
@@ -3289,44 +3247,145 @@ bool UltraCircuitConstructor::check_circuit()
                                        elliptic_base,
                                        alpha)
                  .is_zero()) {
-#ifndef FUZZING
-            info("Elliptic identity fails at gate ", i);
-#endif
-            result = false;
-            break;
+            return "elliptic";
         }
         if (!compute_genperm_sort_identity(
-                 q_sort_value, w_1_value, w_2_value, w_3_value, w_4_value, w_1_shifted_value, genperm_sort_base, alpha)
+                 q_sort[i], w_1_value, w_2_value, w_3_value, w_4_value, w_1_shifted_value, genperm_sort_base, alpha)
                  .is_zero()) {
-#ifndef FUZZING
-            info("Genperm sort identity fails at gate ", i);
-#endif
+            return "genperm sort";
+        }
+        if (!q_lookup_type[i].is_zero() && !table_hash.contains(std::make_tuple(w_1_value + q_2[i] * w_1_shifted_value,
+                                                                                w_2_value + q_m[i] * w_2_shifted_value,
+                                                                                w_3_value + q_c[i] * w_3_shifted_value,
+                                                                                q_3[i]))) {
+            return "lookup";
+        }
+        return nullptr;
+    };
 
-            result = false;
-            break;
+    // Check the gates
+    constexpr size_t GATE_CHUNK_SIZE = 1024;
+    const size_t num_chunks = (num_gates + GATE_CHUNK_SIZE - 1) / GATE_CHUNK_SIZE;
+    const size_t num_threads = std::max(std::min(get_num_cpus(), num_chunks), 1UL);
+    std::atomic<size_t> next_chunk = 0;
+    // num_gates while no gate has failed
+    std::atomic<size_t> first_failing_gate = num_gates;
+    const char* first_failing_relation = nullptr;
+    std::mutex failure_mutex;
+    std::atomic<size_t> num_failing_gates = 0;
+    parallel_for(num_threads, [&](size_t) {
+        size_t thread_num_failing_gates = 0;
+        for (size_t chunk = next_chunk++; chunk < num_chunks; chunk = next_chunk++) {
+            const size_t start = chunk * GATE_CHUNK_SIZE;
+            // Chunks are claimed in increasing order, so no later chunk can hold an earlier failure either
+            if (early_exit && start > first_failing_gate.load()) {
+                break;
+            }
+            const size_t end = std::min(start + GATE_CHUNK_SIZE, num_gates);
+            for (size_t i = start; i < end; ++i) {
+                const char* relation = check_gate(i);
+                if (relation == nullptr) {
+                    continue;
+                }
+                ++thread_num_failing_gates;
+                {
+                    std::lock_guard<std::mutex> lock(failure_mutex);
+                    if (i < first_failing_gate.load()) {
+                        first_failing_gate = i;
+                        first_failing_relation = relation;
+                    }
+                }
+                if (early_exit) {
+                    break;
+                }
+            }
         }
-        if (!q_lookup_type_value.is_zero()) {
-            if (!table_hash.contains(std::make_tuple(w_1_value + q_2_value * w_1_shifted_value,
-                                                     w_2_value + q_m_value * w_2_shifted_value,
-                                                     w_3_value + q_c_value * w_3_shifted_value,
-                                                     q_3_value))) {
+        num_failing_gates += thread_num_failing_gates;
+    });
+    if (first_failing_relation != nullptr) {
 #ifndef FUZZING
-                info("Lookup fails at gate ", i);
+        info("Circuit check: ", first_failing_relation, " fails at gate ", first_failing_gate.load());
 #endif
+        result.passed = false;
+        result.failing_gate = first_failing_gate.load();
+        result.failing_relation = first_failing_relation;
+        result.num_failing_gates = num_failing_gates.load();
+        circuit_backup.restore_prefinilized_state(this);
+        return result;
+    }
 
-                result = false;
-                break;
+    // We use a tag product mechanism to ensure tag correctness. Every tagged variable contributes (value + γ ⋅ tag)
+    // to the left product and (value + γ ⋅ tau[tag]) to the right one, once, with its value at its first occurrence
+    // in the wires (which for a memory record's 4th wire is the value computed above). Wire slot 4 * i + j is wire j
+    // of gate i; first find the first slot of each tagged variable
+    const size_t num_slots = 4 * num_gates;
+    std::vector<std::atomic<size_t>> first_occurrence(real_variable_tags.size());
+    for (auto& slot : first_occurrence) {
+        slot.store(num_slots, std::memory_order_relaxed);
+    }
+    auto get_wire_indices = [&](size_t gate) {
+        return std::array<uint32_t, 4>{ w_l[gate], w_r[gate], w_o[gate], w_4[gate] };
+    };
+    const size_t tag_num_threads = std::max(std::min(get_num_cpus(), num_gates), 1UL);
+    parallel_for(tag_num_threads, [&](size_t thread_idx) {
+        const size_t start = (thread_idx * num_gates) / tag_num_threads;
+        const size_t end = ((thread_idx + 1) * num_gates) / tag_num_threads;
+        for (size_t i = start; i < end; ++i) {
+            const auto wire_indices = get_wire_indices(i);
+            for (size_t j = 0; j < 4; ++j) {
+                const uint32_t real_index = real_variable_index[wire_indices[j]];
+                if (real_variable_tags[real_index] == DUMMY_TAG) {
+                    continue;
+                }
+                const size_t slot = 4 * i + j;
+                size_t current = first_occurrence[real_index].load(std::memory_order_relaxed);
+                while (slot < current && !first_occurrence[real_index].compare_exchange_weak(current, slot)) {
+                }
             }
         }
+    });
+
+    // Randomness for the tag check
+    const fr tag_gamma = fr::random_element();
+    std::vector<fr> left_tag_products(tag_num_threads, fr::one());
+    std::vector<fr> right_tag_products(tag_num_threads, fr::one());
+    parallel_for(tag_num_threads, [&](size_t thread_idx) {
+        const size_t start = (thread_idx * num_gates) / tag_num_threads;
+        const size_t end = ((thread_idx + 1) * num_gates) / tag_num_threads;
+        fr left_tag_product = fr::one();
+        fr right_tag_product = fr::one();
+        for (size_t i = start; i < end; ++i) {
+            const auto wire_indices = get_wire_indices(i);
+            std::optional<std::array<fr, 4>> wire_values;
+            for (size_t j = 0; j < 4; ++j) {
+                const uint32_t real_index = real_variable_index[wire_indices[j]];
+                if (first_occurrence[real_index].load(std::memory_order_relaxed) != 4 * i + j) {
+                    continue;
+                }
+                if (!wire_values.has_value()) {
+                    wire_values = get_wire_values(i);
+                }
+                const uint32_t tag_in = real_variable_tags[real_index];
+                const uint32_t tag_out = tau.at(tag_in);
+                left_tag_product *= (*wire_values)[j] + tag_gamma * fr(tag_in);
+                right_tag_product *= (*wire_values)[j] + tag_gamma * fr(tag_out);
+            }
+        }
+        left_tag_products[thread_idx] = left_tag_product;
+        right_tag_products[thread_idx] = right_tag_product;
+    });
+    fr left_tag_product = fr::one();
+    fr right_tag_product = fr::one();
+    for (size_t i = 0; i < tag_num_threads; ++i) {
+        left_tag_product *= left_tag_products[i];
+        right_tag_product *= right_tag_products[i];
     }
     if (left_tag_product != right_tag_product) {
 #ifndef FUZZING
-        if (result) {
-            info("Tag permutation failed");
-        }
+        info("Tag permutation failed");
 #endif
-
-        result = false;
+        result.passed = false;
+        result.failing_relation = "tag permutation";
     }
     circuit_backup.restore_prefinilized_state(this);
     return result;
@@ -9,6 +9,7 @@
 #include "barretenberg/proof_system/plookup_tables/plookup_tables.hpp"
 #include "barretenberg/plonk/proof_system/types/prover_settings.hpp"
 #include <optional>
+#include <string>
 
 namespace proof_system {
 
@@ -981,7 +982,23 @@ class UltraCircuitConstructor : public CircuitConstructorBase<arithmetization::U
                                      fr alpha_base,
                                      fr alpha) const;
 
+    /**
+     * @brief The outcome of check_circuit_with_failure_info()
+     *
+     * @details failing_gate is the lowest-indexed gate whose identities or lookup fail, and failing_relation names the
+     * first of them to fail there ("arithmetic", "auxiliary", "elliptic", "genperm sort" or "lookup"). If every gate
+     * passes but the tags don't match, failing_gate is empty and failing_relation is "tag permutation".
+     */
+    struct CircuitCheckResult {
+        bool passed = true;
+        std::optional<size_t> failing_gate;
+        std::string failing_relation;
+        // Without early exit, the number of gates that fail. With it, a lower bound
+        size_t num_failing_gates = 0;
+    };
+
     void update_circuit_in_the_head();
     bool check_circuit();
+    CircuitCheckResult check_circuit_with_failure_info(bool early_exit = true);
 };
 } // namespace proof_system
@@ -1,4 +1,5 @@
 #include "ultra_circuit_constructor.hpp"
+#include "sort_memory_records.hpp"
 #include "barretenberg/crypto/generators/generator_data.hpp"
 #include <gtest/gtest.h>
 
@@ -764,6 +765,64 @@ TEST(ultra_circuit_constructor, ram)
     EXPECT_TRUE(saved_state.is_same_state(circuit_constructor));
 }
 
+TEST(ultra_circuit_constructor, ram_multiple_arrays_with_uninitialized_cells)
+{
+    UltraCircuitConstructor circuit_constructor = UltraCircuitConstructor();
+
+    constexpr size_t array_size = 16;
+    for (size_t array = 0; array < 3; ++array) {
+        size_t ram_id = circuit_constructor.create_RAM_array(array_size);
+
+        // leave every third cell uninitialized, process_RAM_array fills these in
+        std::vector<fr> state(array_size, 0);
+        for (size_t i = 0; i < array_size; i += 3) {
+            state[i] = fr::random_element();
+            circuit_constructor.init_RAM_element(ram_id, i, circuit_constructor.add_variable(state[i]));
+        }
+        for (size_t i = 0; i < 32; ++i) {
+            const size_t index = 3 * (engine.get_random_uint32() % ((array_size + 2) / 3));
+            if (engine.get_random_uint8() & 1) {
+                state[index] = fr::random_element();
+                circuit_constructor.write_RAM_array(ram_id,
+                                                    circuit_constructor.add_variable(fr(index)),
+                                                    circuit_constructor.add_variable(state[index]));
+            } else {
+                const uint32_t value_idx =
+                    circuit_constructor.read_RAM_array(ram_id, circuit_constructor.add_variable(fr(index)));
+                EXPECT_EQ(circuit_constructor.get_variable(value_idx), state[index]);
+            }
+        }
+    }
+
+    bool result = circuit_constructor.check_circuit();
+    EXPECT_EQ(result, true);
+}
+
+TEST(ultra_circuit_constructor, sort_memory_records)
+{
+    using RamRecord = UltraCircuitConstructor::RamRecord;
+
+    // enough records to split the sort across threads
+    constexpr size_t num_cells = 64;
+    constexpr size_t num_records = 1 << 16;
+    std::vector<RamRecord> records(num_records);
+    for (size_t i = 0; i < num_records; ++i) {
+        records[i].index = engine.get_random_uint32() % num_cells;
+        records[i].timestamp = static_cast<uint32_t>(i);
+        records[i].value_witness = engine.get_random_uint32();
+    }
+
+    auto expected = records;
+    std::sort(expected.begin(), expected.end());
+    sort_memory_records(records, num_cells);
+
+    for (size_t i = 0; i < num_records; ++i) {
+        EXPECT_EQ(records[i].index, expected[i].index);
+        EXPECT_EQ(records[i].timestamp, expected[i].timestamp);
+        EXPECT_EQ(records[i].value_witness, expected[i].value_witness);
+    }
+}
+
 TEST(ultra_circuit_constructor, range_checks_on_duplicates)
 {
     UltraCircuitConstructor circuit_constructor = UltraCircuitConstructor();
@@ -835,4 +894,101 @@ TEST(ultra_circuit_constructor, check_circuit_showcase)
     EXPECT_EQ(circuit_constructor.check_circuit(), true);
 }
 
+TEST(ultra_circuit_constructor, check_circuit_failure_info)
+{
+    UltraCircuitConstructor circuit_constructor = UltraCircuitConstructor();
+
+    // Enough gates to span several of the chunks that are checked in parallel
+    const size_t num_gates = 5000;
+    std::vector<size_t> bad_gates;
+    for (size_t i = 0; i < num_gates; ++i) {
+        fr a = fr::random_element(&engine);
+        fr b = fr::random_element(&engine);
+        // Gates 3000 and 4500 don't add up
+        const bool is_bad = (i == 3000 || i == 4500);
+        if (is_bad) {
+            bad_gates.emplace_back(circuit_constructor.num_gates);
+        }
+        auto a_idx = circuit_constructor.add_variable(a);
+        auto b_idx = circuit_constructor.add_variable(b);
+        auto c_idx = circuit_constructor.add_variable(is_bad ? a + b + 1 : a + b);
+        circuit_constructor.create_add_gate({ a_idx, b_idx, c_idx, 1, 1, -1, 0 });
+    }
+
+    auto saved_state = UltraCircuitConstructor::CircuitDataBackup::store_full_state(circuit_constructor);
+    auto result = circuit_constructor.check_circuit_with_failure_info();
+    EXPECT_TRUE(saved_state.is_same_state(circuit_constructor));
+    EXPECT_EQ(result.passed, false);
+    ASSERT_TRUE(result.failing_gate.has_value());
+    EXPECT_EQ(result.failing_gate.value(), bad_gates[0]);
+    EXPECT_EQ(result.failing_relation, "arithmetic");
+
+    // Without early exit every failing gate is counted, and the first is still the one reported
+    result = circuit_constructor.check_circuit_with_failure_info(false);
+    EXPECT_EQ(result.passed, false);
+    ASSERT_TRUE(result.failing_gate.has_value());
+    EXPECT_EQ(result.failing_gate.value(), bad_gates[0]);
+    EXPECT_EQ(result.num_failing_gates, 2UL);
+
+    // Once the first is fixed, the second is reported
+    circuit_constructor.w_l[bad_gates[0]] = circuit_constructor.zero_idx;
+    circuit_constructor.w_r[bad_gates[0]] = circuit_constructor.zero_idx;
+    circuit_constructor.w_o[bad_gates[0]] = circuit_constructor.zero_idx;
+    result = circuit_constructor.check_circuit_with_failure_info();
+    ASSERT_TRUE(result.failing_gate.has_value());
+    EXPECT_EQ(result.failing_gate.value(), bad_gates[1]);
+    EXPECT_EQ(result.failing_relation, "arithmetic");
+}
+
+TEST(ultra_circuit_constructor, check_circuit_failure_info_lookup)
+{
+    UltraCircuitConstructor circuit_constructor = UltraCircuitConstructor();
+
+    const fr input_lo = uint256_t(fr::random_element(&engine)).slice(0, 126);
+    const auto input_lo_index = circuit_constructor.add_variable(input_lo);
+    const auto sequence_data_lo = plookup::get_lookup_accumulators(MultiTableId::PEDERSEN_LEFT_LO, input_lo);
+    const size_t first_lookup_gate = circuit_constructor.num_gates;
+    circuit_constructor.create_gates_from_plookup_accumulators(
+        MultiTableId::PEDERSEN_LEFT_LO, sequence_data_lo, input_lo_index);
+    EXPECT_EQ(circuit_constructor.check_circuit_with_failure_info().passed, true);
+
+    // Change the third column of the first lookup
+    const uint32_t output_index = circuit_constructor.w_o[first_lookup_gate];
+    circuit_constructor.variables[circuit_constructor.real_variable_index[output_index]] += 1;
+    auto result = circuit_constructor.check_circuit_with_failure_info();
+    EXPECT_EQ(result.passed, false);
+    ASSERT_TRUE(result.failing_gate.has_value());
+    EXPECT_EQ(result.failing_gate.value(), first_lookup_gate);
+    EXPECT_EQ(result.failing_relation, "lookup");
+}
+
+TEST(ultra_circuit_constructor, check_circuit_failure_info_tags)
+{
+    UltraCircuitConstructor circuit_constructor = UltraCircuitConstructor();
+    fr a = fr::random_element();
+    fr b = -a;
+
+    auto a_idx = circuit_constructor.add_variable(a);
+    auto b_idx = circuit_constructor.add_variable(b);
+    auto c_idx = circuit_constructor.add_variable(b);
+    auto d_idx = circuit_constructor.add_variable(a + 1);
+
+    circuit_constructor.create_add_gate({ a_idx, b_idx, circuit_constructor.zero_idx, 1, 1, 0, 0 });
+    circuit_constructor.create_add_gate({ c_idx, d_idx, circuit_constructor.zero_idx, 1, 1, 0, -1 });
+
+    circuit_constructor.create_tag(1, 2);
+    circuit_constructor.create_tag(2, 1);
+
+    circuit_constructor.assign_tag(a_idx, 1);
+    circuit_constructor.assign_tag(b_idx, 1);
+    circuit_constructor.assign_tag(c_idx, 2);
+    circuit_constructor.assign_tag(d_idx, 2);
+
+    // Every gate is satisfied, so no gate is to blame
+    auto result = circuit_constructor.check_circuit_with_failure_info();
+    EXPECT_EQ(result.passed, false);
+    EXPECT_FALSE(result.failing_gate.has_value());
+    EXPECT_EQ(result.failing_relation, "tag permutation");
+}
+
 } // namespace proof_system
\ No newline at end of file
@@ -376,23 +376,27 @@ void compute_plonk_permutation_lagrange_polynomials_from_mapping(
 template <size_t program_width>
 void compute_monomial_and_coset_fft_polynomials_from_lagrange(std::string label, plonk::proving_key* key)
 {
+    std::array<const barretenberg::fr*, program_width> sigma_lagrange_coefficients;
+    std::array<barretenberg::polynomial, program_width> sigma_polynomials;
+    std::array<barretenberg::fr*, program_width> sigma_coefficients;
+    std::array<barretenberg::polynomial, program_width> sigma_ffts;
+    std::array<barretenberg::fr*, program_width> sigma_fft_coefficients;
     for (size_t i = 0; i < program_width; ++i) {
-        std::string index = std::to_string(i + 1);
-        std::string prefix = label + "_" + index;
-
-        // Construct permutation polynomials in lagrange base
-        barretenberg::polynomial sigma_polynomial_lagrange = key->polynomial_store.get(prefix + "_lagrange");
-        // Compute permutation polynomial monomial form
-        barretenberg::polynomial sigma_polynomial(key->circuit_size);
-        barretenberg::polynomial_arithmetic::ifft(
-            &sigma_polynomial_lagrange[0], &sigma_polynomial[0], key->small_domain);
-
-        // Compute permutation polynomial coset FFT form
-        barretenberg::polynomial sigma_fft(sigma_polynomial, key->large_domain.size);
-        sigma_fft.coset_fft(key->large_domain);
+        std::string prefix = label + "_" + std::to_string(i + 1);
+        sigma_lagrange_coefficients[i] = key->polynomial_store.get(prefix + "_lagrange").data();
+        sigma_polynomials[i] = barretenberg::polynomial(key->circuit_size);
+        sigma_coefficients[i] = sigma_polynomials[i].data();
+        sigma_ffts[i] = barretenberg::polynomial(key->large_domain.size);
+        sigma_fft_coefficients[i] = sigma_ffts[i].data();
+    }
+    // Compute permutation polynomial monomial and coset FFT forms
+    barretenberg::polynomial_arithmetic::coset_lde_from_lagrange<barretenberg::fr>(
+        sigma_lagrange_coefficients, sigma_fft_coefficients, sigma_coefficients, key->small_domain, key->large_domain);
 
-        key->polynomial_store.put(prefix, std::move(sigma_polynomial));
-        key->polynomial_store.put(prefix + "_fft", std::move(sigma_fft));
+    for (size_t i = 0; i < program_width; ++i) {
+        std::string prefix = label + "_" + std::to_string(i + 1);
+        key->polynomial_store.put(prefix, std::move(sigma_polynomials[i]));
+        key->polynomial_store.put(prefix + "_fft", std::move(sigma_ffts[i]));
     }
 }
 
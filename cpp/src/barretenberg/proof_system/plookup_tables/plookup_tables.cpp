@@ -1,5 +1,6 @@
 #include "plookup_tables.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 
 namespace plookup {
 
@@ -108,39 +109,76 @@ const MultiTable& create_table(const MultiTableId id)
     return MULTI_TABLES[id];
 }
 
-ReadData<barretenberg::fr> get_lookup_accumulators(const MultiTableId id,
-                                                   const fr& key_a,
-                                                   const fr& key_b,
-                                                   const bool is_2_to_1_lookup)
+namespace {
+/**
+ * @brief Split `input` into `slices` using the (variable) bases of a multi-table, as per
+ * numeric::slice_input_using_variable_bases, but writing into caller-owned storage.
+ *
+ * @details Most multi-tables slice by powers of two, in which case the uint256_t division is replaced by a mask and a
+ * shift.
+ */
+void slice_key(const uint256_t& input, const std::vector<uint64_t>& bases, uint64_t* slices)
 {
-    // return multi-table, populating global array of all multi-tables if need be
-    const auto& multi_table = create_table(id);
-    const size_t num_lookups = multi_table.lookup_ids.size();
-
-    ReadData<barretenberg::fr> lookup;
+    uint256_t target = input;
+    const size_t num_bases = bases.size();
+    for (size_t i = 0; i < num_bases; ++i) {
+        const uint64_t base = bases[i];
+        if (target >= base && i == num_bases - 1) {
+            throw_or_abort(format("Last key slice greater than ", base));
+        }
+        if ((base & (base - 1)) == 0) {
+            slices[i] = target.data[0] & (base - 1);
+            target >>= static_cast<uint64_t>(numeric::get_msb(base));
+        } else {
+            const auto [quotient, remainder] = target.divmod(uint256_t(base));
+            slices[i] = remainder.data[0];
+            target = quotient;
+        }
+    }
+}
 
-    const auto key_a_slices = numeric::slice_input_using_variable_bases(key_a, multi_table.slice_sizes);
-    const auto key_b_slices = numeric::slice_input_using_variable_bases(key_b, multi_table.slice_sizes);
+/**
+ * @brief Compute the lookup accumulators of a single (key_a, key_b) query into `lookup`.
+ *
+ * @details The columns of `lookup` are resized rather than rebuilt, so a ReadData that is reused across queries into
+ * tables of the same shape is filled without touching the allocator. Raw slice values are written straight into the
+ * output columns and then accumulated in place.
+ */
+void fill_lookup_accumulators(const MultiTable& multi_table,
+                              const fr& key_a,
+                              const fr& key_b,
+                              const bool is_2_to_1_lookup,
+                              ReadData<fr>& lookup)
+{
+    const size_t num_lookups = multi_table.lookup_ids.size();
 
-    std::vector<fr> column_1_raw_values;
-    std::vector<fr> column_2_raw_values;
-    std::vector<fr> column_3_raw_values;
+    // Multi-tables are composed of at most a few dozen basic tables, so the slices fit on the stack
+    constexpr size_t MAX_NUM_LOOKUPS = 64;
+    ASSERT(num_lookups <= MAX_NUM_LOOKUPS);
+    std::array<uint64_t, MAX_NUM_LOOKUPS> key_a_slices;
+    std::array<uint64_t, MAX_NUM_LOOKUPS> key_b_slices;
+    slice_key(uint256_t(key_a), multi_table.slice_sizes, &key_a_slices[0]);
+    slice_key(uint256_t(key_b), multi_table.slice_sizes, &key_b_slices[0]);
+
+    auto& column_1 = lookup[ColumnIdx::C1];
+    auto& column_2 = lookup[ColumnIdx::C2];
+    auto& column_3 = lookup[ColumnIdx::C3];
+    column_1.resize(num_lookups);
+    column_2.resize(num_lookups);
+    column_3.resize(num_lookups);
+    lookup.key_entries.resize(num_lookups);
 
     for (size_t i = 0; i < num_lookups; ++i) {
         // get i-th table query function and then submit query
         const auto values = multi_table.get_table_values[i]({ key_a_slices[i], key_b_slices[i] });
         // store all query data in raw columns and key entry
-        column_1_raw_values.emplace_back(key_a_slices[i]);
-        column_2_raw_values.emplace_back(is_2_to_1_lookup ? key_b_slices[i] : values[0]);
-        column_3_raw_values.emplace_back(is_2_to_1_lookup ? values[0] : values[1]);
+        column_1[i] = key_a_slices[i];
+        column_2[i] = is_2_to_1_lookup ? fr(key_b_slices[i]) : values[0];
+        column_3[i] = is_2_to_1_lookup ? values[0] : values[1];
 
         // Question: why are we storing the key slices twice?
-        const BasicTable::KeyEntry key_entry{ { key_a_slices[i], key_b_slices[i] }, values };
-        lookup.key_entries.emplace_back(key_entry);
+        lookup.key_entries[i] = BasicTable::KeyEntry{ { key_a_slices[i], key_b_slices[i] }, values };
     }
-    lookup[ColumnIdx::C1].resize(num_lookups);
-    lookup[ColumnIdx::C2].resize(num_lookups);
-    lookup[ColumnIdx::C3].resize(num_lookups);
 
     /**
      * A multi-table consists of multiple basic tables (say L = 6).
@@ -177,28 +215,34 @@ ReadData<barretenberg::fr> get_lookup_accumulators(const MultiTableId id,
      * https://app.gitbook.com/o/-LgCgJ8TCO7eGlBr34fj/s/-MEwtqp3H6YhHUTQ_pVJ/plookup-gates-for-ultraplonk/lookup-table-structures
      *
      */
-    lookup[ColumnIdx::C1][num_lookups - 1] = column_1_raw_values[num_lookups - 1];
-    lookup[ColumnIdx::C2][num_lookups - 1] = column_2_raw_values[num_lookups - 1];
-    lookup[ColumnIdx::C3][num_lookups - 1] = column_3_raw_values[num_lookups - 1];
-
-    for (size_t i = 1; i < num_lookups; ++i) {
-        const auto& previous_1 = lookup[ColumnIdx::C1][num_lookups - i];
-        const auto& previous_2 = lookup[ColumnIdx::C2][num_lookups - i];
-        const auto& previous_3 = lookup[ColumnIdx::C3][num_lookups - i];
-
-        auto& current_1 = lookup[ColumnIdx::C1][num_lookups - 1 - i];
-        auto& current_2 = lookup[ColumnIdx::C2][num_lookups - 1 - i];
-        auto& current_3 = lookup[ColumnIdx::C3][num_lookups - 1 - i];
-
-        const auto& raw_1 = column_1_raw_values[num_lookups - 1 - i];
-        const auto& raw_2 = column_2_raw_values[num_lookups - 1 - i];
-        const auto& raw_3 = column_3_raw_values[num_lookups - 1 - i];
-
-        current_1 = raw_1 + previous_1 * multi_table.column_1_step_sizes[num_lookups - i];
-        current_2 = raw_2 + previous_2 * multi_table.column_2_step_sizes[num_lookups - i];
-        current_3 = raw_3 + previous_3 * multi_table.column_3_step_sizes[num_lookups - i];
+    for (size_t i = num_lookups - 1; i > 0; --i) {
+        column_1[i - 1] += column_1[i] * multi_table.column_1_step_sizes[i];
+        column_2[i - 1] += column_2[i] * multi_table.column_2_step_sizes[i];
+        column_3[i - 1] += column_3[i] * multi_table.column_3_step_sizes[i];
     }
+}
+} // namespace
+
+ReadData<barretenberg::fr> get_lookup_accumulators(const MultiTableId id,
+                                                   const fr& key_a,
+                                                   const fr& key_b,
+                                                   const bool is_2_to_1_lookup)
+{
+    // return multi-table, populating global array of all multi-tables if need be
+    const auto& multi_table = create_table(id);
+
+    ReadData<barretenberg::fr> lookup;
+    fill_lookup_accumulators(multi_table, key_a, key_b, is_2_to_1_lookup, lookup);
     return lookup;
 }
 
+void get_lookup_accumulators(const MultiTableId id,
+                             const fr& key_a,
+                             const fr& key_b,
+                             const bool is_2_to_1_lookup,
+                             ReadData<barretenberg::fr>& lookup)
+{
+    fill_lookup_accumulators(create_table(id), key_a, key_b, is_2_to_1_lookup, lookup);
+}
+
 } // namespace plookup
@@ -24,6 +24,16 @@ ReadData<barretenberg::fr> get_lookup_accumulators(const MultiTableId id,
                                                    const barretenberg::fr& key_b = 0,
                                                    const bool is_2_to_1_map = false);
 
+/**
+ * @brief As above, but filling `lookup` in place, so a caller that reuses one ReadData across queries into tables of
+ * the same shape does not reallocate.
+ */
+void get_lookup_accumulators(const MultiTableId id,
+                             const barretenberg::fr& key_a,
+                             const barretenberg::fr& key_b,
+                             const bool is_2_to_1_map,
+                             ReadData<barretenberg::fr>& lookup);
+
 inline BasicTable create_basic_table(const BasicTableId id, const size_t index)
 {
     switch (id) {
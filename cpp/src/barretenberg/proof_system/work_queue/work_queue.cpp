@@ -1,5 +1,6 @@
 #include "work_queue.hpp"
 
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/fixed_base_point_table.hpp"
 #include "barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 
@@ -194,6 +195,9 @@ void work_queue::add_to_queue(const work_item& item)
 
 void work_queue::process_queue()
 {
+    // FFT items only read monomial forms (those an IFFT item puts in the store included), and nothing in the queue reads
+    // the coset forms they produce. So they are set aside and run as one batch once the rest of the queue is done
+    std::vector<const work_item*> fft_items;
     for (const auto& item : work_item_queue) {
         switch (item.work_type) {
         // most expensive op
@@ -204,11 +208,16 @@ void work_queue::process_queue()
             ASSERT(msm_size <= key->reference_string->get_monomial_size());
 
             barretenberg::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
+            auto fixed_base_table = key->reference_string->get_fixed_base_table();
 
-            // Run pippenger multi-scalar multiplication.
-            auto runtime_state = barretenberg::scalar_multiplication::pippenger_runtime_state(msm_size);
-            barretenberg::g1::affine_element result(barretenberg::scalar_multiplication::pippenger_unsafe(
-                item.mul_scalars, srs_points, msm_size, runtime_state));
+            // Run pippenger multi-scalar multiplication. The key's runtime state bounds its scratch memory; it
+            // chunks the MSM if it was sized below msm_size. A precomputed fixed-base table is used if the state was
+            // sized for it, and otherwise falls back to the same.
+            barretenberg::g1::affine_element result(
+                fixed_base_table != nullptr
+                    ? fixed_base_table->pippenger_unsafe(item.mul_scalars, msm_size, key->pippenger_runtime_state)
+                    : barretenberg::scalar_multiplication::pippenger_unsafe(
+                          item.mul_scalars, srs_points, msm_size, key->pippenger_runtime_state));
 
             transcript->add_element(item.tag, result.to_buffer());
 
@@ -240,17 +249,7 @@ void work_queue::process_queue()
             break;
         }
         case WorkType::FFT: {
-            using namespace barretenberg;
-            polynomial& wire = key->polynomial_store.get(item.tag);
-            polynomial wire_fft(wire, 4 * key->circuit_size + 4);
-
-            wire_fft.coset_fft(key->large_domain);
-            for (size_t i = 0; i < 4; i++) {
-                wire_fft[4 * key->circuit_size + i] = wire_fft[i];
-            }
-
-            key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
-
+            fft_items.push_back(&item);
             break;
         }
         // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
@@ -270,9 +269,38 @@ void work_queue::process_queue()
         }
         }
     }
+    if (!fft_items.empty()) {
+        process_fft_items(fft_items);
+    }
     work_item_queue = std::vector<work_item>();
 }
 
+/**
+ * @brief Compute the coset FFTs over the large domain of the polynomials named by FFT work items, as one batch
+ */
+void work_queue::process_fft_items(const std::vector<const work_item*>& fft_items)
+{
+    using namespace barretenberg;
+    const size_t n = key->circuit_size;
+    std::vector<polynomial> poly_ffts;
+    std::vector<fr*> poly_fft_coefficients;
+    poly_ffts.reserve(fft_items.size());
+    for (const work_item* item : fft_items) {
+        polynomial& poly = key->polynomial_store.get(item->tag);
+        poly_ffts.emplace_back(poly, 4 * n + 4);
+        poly_fft_coefficients.emplace_back(poly_ffts.back().data());
+    }
+
+    polynomial_arithmetic::coset_fft_batch<fr>(poly_fft_coefficients, key->large_domain);
+
+    for (size_t k = 0; k < fft_items.size(); ++k) {
+        for (size_t i = 0; i < 4; i++) {
+            poly_ffts[k][4 * n + i] = poly_ffts[k][i];
+        }
+        key->polynomial_store.put(fft_items[k]->tag + "_fft", std::move(poly_ffts[k]));
+    }
+}
+
 std::vector<work_queue::work_item> work_queue::get_queue() const
 {
     return work_item_queue;
@@ -61,6 +61,8 @@ class work_queue {
     std::vector<work_item> get_queue() const;
 
   private:
+    void process_fft_items(const std::vector<const work_item*>& fft_items);
+
     proving_key* key;
     transcript::StandardTranscript* transcript;
     std::vector<work_item> work_item_queue;
@@ -15,7 +15,11 @@
 #include "msgpack_impl/variant_impl.hpp"
 #include "msgpack_impl/func_traits.hpp"
 
+#include "barretenberg/common/throw_or_abort.hpp"
+
+#include <bit>
 #include <cstring>
+#include <memory>
 #include <type_traits>
 
 /**
@@ -73,6 +77,81 @@ inline void msgpack_cbind_impl(auto func,               // The function to be ap
     *output_len_out = output_len;
 }
 
+// The tuple type with every element type decayed, e.g. std::tuple<fr, std::vector<fr> const&> -> std::tuple<fr,
+// std::vector<fr>>. Only used in unevaluated contexts.
+template <typename... Ts> std::tuple<std::decay_t<Ts>...> decay_tuple(std::tuple<Ts...> const&);
+
+/**
+ * A msgpack write target over a caller-provided buffer. Writes past the end are dropped but still counted, so size()
+ * always reports the number of bytes the full output needs.
+ */
+class MsgpackSpanWriter {
+  public:
+    MsgpackSpanWriter(uint8_t* data, size_t capacity)
+        : data_(data)
+        , capacity_(capacity)
+    {}
+
+    void write(const char* buf, size_t len)
+    {
+        if (size_ + len <= capacity_) {
+            memcpy(data_ + size_, buf, len);
+        }
+        size_ += len;
+    }
+
+    size_t size() const { return size_; }
+
+  private:
+    uint8_t* data_;
+    size_t capacity_;
+    size_t size_ = 0;
+};
+
+// Batched counterpart of msgpack_cbind_impl, for small functions called at high frequency where marshalling would
+// otherwise dominate.
+// The input is a msgpack array of calls, each encoded as the argument array msgpack_cbind_impl takes. The output is a
+// msgpack array of the results, written straight into the caller's buffer; if it doesn't fit, *output_len_out is set
+// to the size needed (greater than output_capacity) and the buffer contents are unspecified.
+// Nothing is allocated in the steady state: the decoded object tree lives in a per-thread zone that is reset rather
+// than freed between batches, binary/string payloads reference the input buffer instead of being copied into it, and
+// every call of the batch decodes into the same argument tuple.
+inline void msgpack_cbind_batch_impl(auto func,
+                                     const uint8_t* input_in,
+                                     size_t input_len_in,
+                                     uint8_t* output,
+                                     size_t output_capacity,
+                                     size_t* output_len_out)
+{
+    // Decayed so that reference parameters (e.g. std::vector<fr> const&) get storage of their own to be reused
+    using Params = decltype(decay_tuple(std::declval<typename func_args<decltype(func)>::type>()));
+    thread_local Params params;
+    thread_local std::unique_ptr<msgpack::zone> zone;
+    thread_local size_t zone_chunk_size = 0;
+
+    // zone::clear() only keeps the zone's first chunk, so size that from the input to keep typical batches in it
+    if (zone == nullptr || zone_chunk_size < 4 * input_len_in) {
+        zone_chunk_size = std::max<size_t>(MSGPACK_ZONE_CHUNK_SIZE, std::bit_ceil(4 * input_len_in));
+        zone = std::make_unique<msgpack::zone>(zone_chunk_size);
+    } else {
+        zone->clear();
+    }
+    auto reference_input = [](msgpack::type::object_type, size_t, void*) { return true; };
+    const msgpack::object calls = msgpack::unpack(*zone, (const char*)input_in, input_len_in, reference_input);
+    if (calls.type != msgpack::type::ARRAY) {
+        throw_or_abort("msgpack_cbind_batch_impl: expected an array of calls");
+    }
+
+    MsgpackSpanWriter writer(output, output_capacity);
+    msgpack::packer packer(writer);
+    packer.pack_array(calls.via.array.size);
+    for (uint32_t i = 0; i < calls.via.array.size; ++i) {
+        calls.via.array.ptr[i].convert(params);
+        packer.pack(std::apply(func, params));
+    }
+    *output_len_out = writer.size();
+}
+
 // returns a C-style string json of the schema
 inline void msgpack_cbind_schema_impl(auto func, uint8_t** output_out, size_t* output_len_out)
 {
@@ -90,6 +169,7 @@ inline void msgpack_cbind_schema_impl(auto func, uint8_t** output_out, size_t* o
 // 1. cname function: This decodes the input arguments from msgpack format, calls the target function,
 // and then encodes the return value back into msgpack format.
 // 2. cname##__schema function: This creates a JSON schema of the function's input arguments and return type.
+// 3. cname##__batch function: The batched form of cname, see msgpack_cbind_batch_impl.
 #define CBIND(cname, func)                                                                                             \
     WASM_EXPORT void cname(const uint8_t* input_in, size_t input_len_in, uint8_t** output_out, size_t* output_len_out) \
     {                                                                                                                  \
@@ -98,4 +178,12 @@ inline void msgpack_cbind_schema_impl(auto func, uint8_t** output_out, size_t* o
     WASM_EXPORT void cname##__schema(uint8_t** output_out, size_t* output_len_out)                                     \
     {                                                                                                                  \
         msgpack_cbind_schema_impl(func, output_out, output_len_out);                                                   \
+    }                                                                                                                  \
+    WASM_EXPORT void cname##__batch(const uint8_t* input_in,                                                           \
+                                    size_t input_len_in,                                                               \
+                                    uint8_t* output,                                                                   \
+                                    size_t output_capacity,                                                            \
+                                    size_t* output_len_out)                                                            \
+    {                                                                                                                  \
+        msgpack_cbind_batch_impl(func, input_in, input_len_in, output, output_capacity, output_len_out);               \
     }
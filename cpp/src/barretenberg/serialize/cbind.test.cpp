@@ -0,0 +1,86 @@
+#include "barretenberg/serialize/cbind.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace barretenberg;
+
+namespace {
+auto mul_add = [](fr a, fr b, std::vector<fr> const& terms) {
+    fr result = a * b;
+    for (auto& term : terms) {
+        result += term;
+    }
+    return result;
+};
+// msgpack_cbind_impl needs default constructible parameters
+auto mul_add_by_value = [](fr a, fr b, std::vector<fr> terms) { return mul_add(a, b, terms); };
+
+std::vector<uint8_t> pack_calls(std::vector<std::tuple<fr, fr, std::vector<fr>>> const& calls)
+{
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, calls);
+    return { (uint8_t*)buffer.data(), (uint8_t*)buffer.data() + buffer.size() };
+}
+} // namespace
+
+TEST(cbind, batch_matches_single_calls)
+{
+    std::vector<std::tuple<fr, fr, std::vector<fr>>> calls;
+    for (size_t i = 0; i < 100; ++i) {
+        calls.emplace_back(fr::random_element(), fr::random_element(), std::vector<fr>(i % 5, fr::random_element()));
+    }
+    auto input = pack_calls(calls);
+
+    std::vector<uint8_t> output(64 * 1024);
+    size_t output_len = 0;
+    msgpack_cbind_batch_impl(mul_add, input.data(), input.size(), output.data(), output.size(), &output_len);
+    ASSERT_LE(output_len, output.size());
+
+    std::vector<fr> results;
+    msgpack::unpack((const char*)output.data(), output_len).get().convert(results);
+    ASSERT_EQ(results.size(), calls.size());
+    for (size_t i = 0; i < calls.size(); ++i) {
+        msgpack::sbuffer single_input;
+        msgpack::pack(single_input, calls[i]);
+        uint8_t* single_output = nullptr;
+        size_t single_output_len = 0;
+        msgpack_cbind_impl(mul_add_by_value,
+                           (const uint8_t*)single_input.data(),
+                           single_input.size(),
+                           &single_output,
+                           &single_output_len);
+        fr expected;
+        msgpack::unpack((const char*)single_output, single_output_len).get().convert(expected);
+        aligned_free(single_output);
+
+        EXPECT_EQ(results[i], expected);
+    }
+
+    // A second batch reuses the decoding state; results must not leak between batches
+    calls.resize(3);
+    input = pack_calls(calls);
+    msgpack_cbind_batch_impl(mul_add, input.data(), input.size(), output.data(), output.size(), &output_len);
+    msgpack::unpack((const char*)output.data(), output_len).get().convert(results);
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_EQ(results[2], mul_add(std::get<0>(calls[2]), std::get<1>(calls[2]), std::get<2>(calls[2])));
+}
+
+TEST(cbind, batch_reports_required_output_size)
+{
+    std::vector<std::tuple<fr, fr, std::vector<fr>>> calls(10, { fr(2), fr(3), { fr(1) } });
+    auto input = pack_calls(calls);
+
+    std::vector<uint8_t> output(16);
+    size_t output_len = 0;
+    msgpack_cbind_batch_impl(mul_add, input.data(), input.size(), output.data(), output.size(), &output_len);
+    ASSERT_GT(output_len, output.size());
+
+    output.resize(output_len);
+    size_t retry_len = 0;
+    msgpack_cbind_batch_impl(mul_add, input.data(), input.size(), output.data(), output.size(), &retry_len);
+    EXPECT_EQ(retry_len, output_len);
+    std::vector<fr> results;
+    msgpack::unpack((const char*)output.data(), retry_len).get().convert(results);
+    EXPECT_EQ(results, std::vector<fr>(10, fr(7)));
+}
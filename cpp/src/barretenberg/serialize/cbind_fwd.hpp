@@ -8,4 +8,6 @@
 #define CBIND_DECL(cname)                                                                                              \
     WASM_EXPORT void cname(                                                                                            \
         const uint8_t* input_in, size_t input_len_in, uint8_t** output_out, size_t* output_len_out);                   \
-    WASM_EXPORT void cname##__schema(uint8_t** output_out, size_t* output_len_out);
+    WASM_EXPORT void cname##__schema(uint8_t** output_out, size_t* output_len_out);                                   \
+    WASM_EXPORT void cname##__batch(                                                                                   \
+        const uint8_t* input_in, size_t input_len_in, uint8_t* output, size_t output_capacity, size_t* output_len_out);
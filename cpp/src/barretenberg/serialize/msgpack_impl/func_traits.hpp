@@ -50,3 +50,12 @@ template <typename T> constexpr auto get_func_traits()
     // If T is not a lambda, just deduce its traits using func_traits
     return func_traits<T>();
 }
+
+// The argument tuple type of a function or lambda. Unlike get_func_traits() this doesn't construct func_traits, so it
+// also works for functions taking reference parameters
+template <typename T> struct func_args {
+    using type = typename func_traits<T>::Args;
+};
+template <LambdaType T> struct func_args<T> {
+    using type = typename func_traits<decltype(&T::operator())>::Args;
+};
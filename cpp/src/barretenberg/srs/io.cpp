@@ -2,8 +2,12 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/net.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp"
+#include <cerrno>
+#include <fcntl.h>
 #include <fstream>
 #include <sys/stat.h>
+#include <unistd.h>
 
 namespace barretenberg {
 namespace io {
@@ -137,8 +141,52 @@ bool is_file_exist(std::string const& fileName)
     return infile.good();
 }
 
-void read_transcript_g1(g1::affine_element* monomials, size_t degree, std::string const& dir)
+/**
+ * A contiguous run of g1 points within a single transcript file. Chunks are the unit of work for the parallel loader.
+ */
+struct TranscriptChunk {
+    size_t file_index;
+    size_t file_offset;
+    size_t point_offset;
+    size_t num_points;
+};
+
+// 1 << 14 points is 1MB per chunk: large enough to keep the disk queue busy, small enough to balance across threads.
+constexpr size_t TRANSCRIPT_CHUNK_POINTS = 1UL << 14;
+
+/**
+ * Read `size` bytes from `fd` at `offset`, retrying on short reads. Returns the number of bytes actually read.
+ */
+size_t pread_fully(int fd, char* buffer, size_t size, size_t offset)
 {
+    size_t total = 0;
+    while (total < size) {
+        ssize_t result = pread(fd, buffer + total, size - total, (off_t)(offset + total));
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            break;
+        }
+        total += (size_t)result;
+    }
+    return total;
+}
+
+/**
+ * Load g1 points [start, degree) of the transcript in `dir` into their final positions in `output`.
+ *
+ * The manifests are read up front so that the file layout of every point is known. The points are then split into
+ * fixed size chunks that are read with `pread` and converted to Montgomery form on worker threads, so that disk reads,
+ * byteswapping and field conversion overlap. If `point_table` is set, the output is written in the pippenger point
+ * table layout (each point followed by its endomorphism image) in the same pass, and `output` must be sized as per
+ * `scalar_multiplication::point_table_size`.
+ */
+void read_transcript_g1_chunked(
+    g1::affine_element* output, size_t start, size_t degree, std::string const& dir, bool point_table)
+{
+    std::vector<int> fds;
+    std::vector<TranscriptChunk> chunks;
     size_t num = 0;
     size_t num_read = 0;
     std::string path = get_transcript_path(dir, num);
@@ -147,22 +195,71 @@ void read_transcript_g1(g1::affine_element* monomials, size_t degree, std::strin
         Manifest manifest;
         read_manifest(path, manifest);
 
-        auto offset = sizeof(Manifest);
         const size_t num_to_read = std::min((size_t)manifest.num_g1_points, degree - num_read);
-        const size_t g1_buffer_size = sizeof(fq) * 2 * num_to_read;
-
-        char* buffer = (char*)&monomials[num_read];
-        size_t size = 0;
+        if (num_read + num_to_read <= start) {
+            num_read += num_to_read;
+            path = get_transcript_path(dir, ++num);
+            continue;
+        }
 
-        // We must pass the size actually read to the second call, not the desired
-        // g1_buffer_size as the file may have been smaller than this.
-        read_file_into_buffer(buffer, size, path, offset, g1_buffer_size);
-        byteswap(&monomials[num_read], size);
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            break;
+        }
+#ifdef POSIX_FADV_SEQUENTIAL
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+        fds.push_back(fd);
+
+        const size_t first = start > num_read ? start - num_read : 0;
+        for (size_t i = first; i < num_to_read; i += TRANSCRIPT_CHUNK_POINTS) {
+            chunks.push_back({ fds.size() - 1,
+                               sizeof(Manifest) + i * sizeof(g1::affine_element),
+                               num_read + i,
+                               std::min(TRANSCRIPT_CHUNK_POINTS, num_to_read - i) });
+        }
 
         num_read += num_to_read;
         path = get_transcript_path(dir, ++num);
     }
 
+    // Exceptions cannot escape an OpenMP region, so record the bytes each chunk actually read and validate afterwards.
+    std::vector<size_t> bytes_read(chunks.size(), 0);
+#ifndef NO_MULTITHREADING
+#pragma omp parallel
+#endif
+    {
+        std::vector<g1::affine_element> scratch(point_table ? TRANSCRIPT_CHUNK_POINTS : 0);
+#ifndef NO_MULTITHREADING
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            const auto& chunk = chunks[i];
+            g1::affine_element* points = point_table ? &scratch[0] : &output[chunk.point_offset];
+            const size_t buffer_size = chunk.num_points * sizeof(g1::affine_element);
+            bytes_read[i] = pread_fully(fds[chunk.file_index], (char*)points, buffer_size, chunk.file_offset);
+            if (bytes_read[i] != buffer_size) {
+                continue;
+            }
+            byteswap(points, buffer_size);
+            if (point_table) {
+                scalar_multiplication::generate_pippenger_point_table(
+                    points, &output[chunk.point_offset * 2], chunk.num_points);
+            }
+        }
+    }
+
+    for (int fd : fds) {
+        close(fd);
+    }
+
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        const size_t expected = chunks[i].num_points * sizeof(g1::affine_element);
+        if (bytes_read[i] != expected) {
+            throw_or_abort(format("Only read ", bytes_read[i], " bytes from file but expected ", expected, "."));
+        }
+    }
+
     const bool monomial_srs_condition = num_read < degree;
     if (monomial_srs_condition) {
         throw_or_abort(format("Only read ",
@@ -178,6 +275,19 @@ void read_transcript_g1(g1::affine_element* monomials, size_t degree, std::strin
     }
 }
 
+void read_transcript_g1(g1::affine_element* monomials, size_t degree, std::string const& dir)
+{
+    read_transcript_g1_chunked(monomials, 0, degree, dir, false);
+}
+
+void read_transcript_g1_point_table(g1::affine_element* point_table,
+                                    size_t degree,
+                                    std::string const& dir,
+                                    size_t start_from)
+{
+    read_transcript_g1_chunked(point_table, start_from, degree, dir, true);
+}
+
 void read_transcript_g2(g2::affine_element& g2_x, std::string const& dir)
 {
 
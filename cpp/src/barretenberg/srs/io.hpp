@@ -19,6 +19,18 @@ struct Manifest {
 
 void read_transcript_g1(g1::affine_element* monomials, size_t degree, std::string const& dir);
 
+/**
+ * Read the first `degree` g1 points directly into a pippenger point table (each point followed by its endomorphism
+ * image). Equivalent to `read_transcript_g1` followed by `generate_pippenger_point_table`, but done in a single
+ * parallel pass over the transcript files.
+ * If `start_from` is non-zero, only points [start_from, degree) are read and the table entries for earlier points are
+ * left untouched. This is used to extend an already populated table.
+ */
+void read_transcript_g1_point_table(g1::affine_element* point_table,
+                                    size_t degree,
+                                    std::string const& dir,
+                                    size_t start_from = 0);
+
 void read_transcript_g2(g2::affine_element& g2_x, std::string const& dir);
 
 void read_transcript(g1::affine_element* monomials, g2::affine_element& g2_x, size_t degree, std::string const& path);
@@ -2,6 +2,7 @@
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "io.hpp"
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/pippenger.hpp"
 #include <gtest/gtest.h>
 
 using namespace barretenberg;
@@ -30,3 +31,19 @@ TEST(io, read_transcript_loads_well_formed_srs)
     }
     aligned_free(monomials);
 }
+
+TEST(io, read_transcript_g1_point_table_matches_serial_table)
+{
+    size_t degree = 100000;
+    g1::affine_element* monomials = scalar_multiplication::point_table_alloc<g1::affine_element>(degree);
+    g1::affine_element* point_table = scalar_multiplication::point_table_alloc<g1::affine_element>(degree);
+    io::read_transcript_g1(monomials, degree, "../srs_db/ignition");
+    scalar_multiplication::generate_pippenger_point_table(monomials, monomials, degree);
+    io::read_transcript_g1_point_table(point_table, degree, "../srs_db/ignition");
+
+    for (size_t i = 0; i < degree * 2; ++i) {
+        EXPECT_EQ(monomials[i], point_table[i]);
+    }
+    aligned_free(point_table);
+    aligned_free(monomials);
+}
@@ -20,4 +20,18 @@ VerifierFileReferenceString::~VerifierFileReferenceString()
     aligned_free(precomputed_g2_lines);
 }
 
+std::shared_ptr<scalar_multiplication::Pippenger> grow_point_table(
+    std::shared_ptr<scalar_multiplication::Pippenger> const& current, std::string const& path, size_t degree)
+{
+    if (current == nullptr) {
+        return std::make_shared<scalar_multiplication::Pippenger>(path, degree);
+    }
+    if (current->grow(path, degree)) {
+        return current;
+    }
+    // Double the capacity so that a sequence of slightly larger requests does not reallocate every time.
+    const size_t capacity = std::max(degree, 2 * current->get_capacity());
+    return std::make_shared<scalar_multiplication::Pippenger>(path, degree, capacity, current.get());
+}
+
 } // namespace proof_system
@@ -33,22 +33,47 @@ class VerifierFileReferenceString : public VerifierReferenceString {
     pairing::miller_lines* precomputed_g2_lines;
 };
 
+/**
+ * A prover reference string backed by a (possibly shared) pippenger point table loaded from transcript files.
+ * Several instances of differing degree may view the same table, each exposing only its first `num_points` points.
+ */
 class FileReferenceString : public ProverReferenceString {
   public:
     FileReferenceString(const size_t num_points, std::string const& path)
         : num_points(num_points)
-        , pippenger_(path, num_points)
+        , pippenger_(std::make_shared<scalar_multiplication::Pippenger>(path, num_points))
     {}
 
-    g1::affine_element* get_monomial_points() override { return pippenger_.get_point_table(); }
+    FileReferenceString(std::shared_ptr<scalar_multiplication::Pippenger> pippenger, const size_t num_points)
+        : num_points(num_points)
+        , pippenger_(std::move(pippenger))
+    {
+        ASSERT(num_points <= pippenger_->get_num_points());
+    }
+
+    g1::affine_element* get_monomial_points() override { return pippenger_->get_point_table(); }
 
     size_t get_monomial_size() const override { return num_points; }
 
+    std::shared_ptr<const scalar_multiplication::FixedBasePointTable> get_fixed_base_table() const override
+    {
+        return pippenger_->get_fixed_base_table();
+    }
+
   private:
     size_t num_points;
-    scalar_multiplication::Pippenger pippenger_;
+    std::shared_ptr<scalar_multiplication::Pippenger> pippenger_;
 };
 
+/**
+ * Return a point table holding at least `degree` points from the transcript at `path`.
+ * An existing table is extended in place when it has headroom, and otherwise its converted points are copied into a
+ * larger allocation so that only the missing tail is read from disk. Tables that are replaced stay alive for as long as
+ * reference strings still view them.
+ */
+std::shared_ptr<scalar_multiplication::Pippenger> grow_point_table(
+    std::shared_ptr<scalar_multiplication::Pippenger> const& current, std::string const& path, size_t degree);
+
 class FileReferenceStringFactory : public ReferenceStringFactory {
   public:
     FileReferenceStringFactory(std::string path)
@@ -57,9 +82,20 @@ class FileReferenceStringFactory : public ReferenceStringFactory {
 
     FileReferenceStringFactory(FileReferenceStringFactory&& other) = default;
 
+    /**
+     * Build `num_copies` scaled copies of the point table for faster commitments (see
+     * scalar_multiplication::FixedBasePointTable), which multiplies the table's memory by `num_copies`. The copies are
+     * (re)built whenever the table grows.
+     */
+    void set_fixed_base_copies(size_t num_copies) { fixed_base_copies_ = num_copies; }
+
     std::shared_ptr<ProverReferenceString> get_prover_crs(size_t degree) override
     {
-        return std::make_shared<FileReferenceString>(degree, path_);
+        pippenger_ = grow_point_table(pippenger_, path_, degree);
+        if (fixed_base_copies_ > 0) {
+            pippenger_->precompute_fixed_base(fixed_base_copies_);
+        }
+        return std::make_shared<FileReferenceString>(pippenger_, degree);
     }
 
     std::shared_ptr<VerifierReferenceString> get_verifier_crs() override
@@ -69,34 +105,46 @@ class FileReferenceStringFactory : public ReferenceStringFactory {
 
   private:
     std::string path_;
+    std::shared_ptr<scalar_multiplication::Pippenger> pippenger_;
+    size_t fixed_base_copies_ = 0;
 };
 
 class DynamicFileReferenceStringFactory : public ReferenceStringFactory {
   public:
     DynamicFileReferenceStringFactory(std::string path, size_t initial_degree = 0)
         : path_(std::move(path))
-        , degree_(initial_degree)
         , verifier_crs_(std::make_shared<VerifierFileReferenceString>(path_))
-    {}
+    {
+        if (initial_degree > 0) {
+            pippenger_ = grow_point_table(pippenger_, path_, initial_degree);
+        }
+    }
 
     DynamicFileReferenceStringFactory(DynamicFileReferenceStringFactory&& other) = default;
 
+    /**
+     * Build `num_copies` scaled copies of the point table for faster commitments (see
+     * scalar_multiplication::FixedBasePointTable), which multiplies the table's memory by `num_copies`. The copies are
+     * (re)built whenever the table grows.
+     */
+    void set_fixed_base_copies(size_t num_copies) { fixed_base_copies_ = num_copies; }
+
     std::shared_ptr<ProverReferenceString> get_prover_crs(size_t degree) override
     {
-        if (degree != degree_) {
-            prover_crs_ = std::make_shared<FileReferenceString>(degree, path_);
-            degree_ = degree;
+        pippenger_ = grow_point_table(pippenger_, path_, degree);
+        if (fixed_base_copies_ > 0) {
+            pippenger_->precompute_fixed_base(fixed_base_copies_);
         }
-        return prover_crs_;
+        return std::make_shared<FileReferenceString>(pippenger_, degree);
     }
 
     std::shared_ptr<VerifierReferenceString> get_verifier_crs() override { return verifier_crs_; }
 
   private:
     std::string path_;
-    size_t degree_;
-    std::shared_ptr<FileReferenceString> prover_crs_;
+    std::shared_ptr<scalar_multiplication::Pippenger> pippenger_;
     std::shared_ptr<VerifierFileReferenceString> verifier_crs_;
+    size_t fixed_base_copies_ = 0;
 };
 
 } // namespace proof_system
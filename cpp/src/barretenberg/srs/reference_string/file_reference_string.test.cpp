@@ -0,0 +1,48 @@
+#include "file_reference_string.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(reference_string, dynamic_file_factory_grows_without_reloading)
+{
+    auto fresh_crs = std::make_unique<proof_system::FileReferenceStringFactory>("../srs_db/ignition");
+    auto dynamic_crs = std::make_unique<proof_system::DynamicFileReferenceStringFactory>("../srs_db/ignition");
+
+    auto small = dynamic_crs->get_prover_crs(1024);
+    auto* small_points = small->get_monomial_points();
+    auto large = dynamic_crs->get_prover_crs(4096);
+    auto smaller = dynamic_crs->get_prover_crs(512);
+
+    EXPECT_EQ(small->get_monomial_size(), 1024UL);
+    EXPECT_EQ(large->get_monomial_size(), 4096UL);
+    EXPECT_EQ(smaller->get_monomial_size(), 512UL);
+
+    // A smaller degree is a view into the table that is already loaded.
+    EXPECT_EQ(smaller->get_monomial_points(), large->get_monomial_points());
+    // The original view keeps its own table alive after the factory reallocates.
+    EXPECT_EQ(small->get_monomial_points(), small_points);
+
+    auto expected = fresh_crs->get_prover_crs(4096)->get_monomial_points();
+    auto* large_points = large->get_monomial_points();
+    for (size_t i = 0; i < 4096 * 2; ++i) {
+        EXPECT_EQ(large_points[i], expected[i]);
+    }
+    for (size_t i = 0; i < 1024 * 2; ++i) {
+        EXPECT_EQ(small_points[i], expected[i]);
+    }
+}
+
+TEST(reference_string, pippenger_grows_in_place_with_headroom)
+{
+    auto pippenger = std::make_shared<barretenberg::scalar_multiplication::Pippenger>("../srs_db/ignition", 256, 1024);
+    auto* points = pippenger->get_point_table();
+    auto grown = proof_system::grow_point_table(pippenger, "../srs_db/ignition", 1000);
+
+    EXPECT_EQ(grown, pippenger);
+    EXPECT_EQ(grown->get_point_table(), points);
+    EXPECT_EQ(grown->get_num_points(), 1000UL);
+
+    barretenberg::scalar_multiplication::Pippenger expected("../srs_db/ignition", 1000);
+    for (size_t i = 0; i < 1000 * 2; ++i) {
+        EXPECT_EQ(points[i], expected.get_point_table()[i]);
+    }
+}
@@ -22,6 +22,11 @@ class PippengerReferenceString : public ProverReferenceString {
     size_t get_monomial_size() const override { return pippenger_->get_num_points(); }
     g1::affine_element* get_monomial_points() override { return pippenger_->get_point_table(); }
 
+    std::shared_ptr<const scalar_multiplication::FixedBasePointTable> get_fixed_base_table() const override
+    {
+        return pippenger_->get_fixed_base_table();
+    }
+
   private:
     scalar_multiplication::Pippenger* pippenger_;
 };
@@ -5,11 +5,16 @@
 #include "barretenberg/ecc/curves/bn254/g2.hpp"
 
 #include <cstddef>
+#include <memory>
 
 namespace barretenberg::pairing {
 struct miller_lines;
 } // namespace barretenberg::pairing
 
+namespace barretenberg::scalar_multiplication {
+class FixedBasePointTable;
+} // namespace barretenberg::scalar_multiplication
+
 namespace proof_system {
 
 class VerifierReferenceString {
@@ -29,6 +34,12 @@ class ProverReferenceString {
 
     virtual barretenberg::g1::affine_element* get_monomial_points() = 0;
     virtual size_t get_monomial_size() const = 0;
+
+    // Precomputed copies of the monomial points for faster commitments, if they have been built
+    virtual std::shared_ptr<const barretenberg::scalar_multiplication::FixedBasePointTable> get_fixed_base_table() const
+    {
+        return nullptr;
+    }
 };
 
 class ReferenceStringFactory {
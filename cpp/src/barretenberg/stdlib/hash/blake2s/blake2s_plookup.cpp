@@ -93,18 +93,18 @@ template <typename Composer> void blake2s_compress(blake2s_state<Composer>& S, b
     v[11] = field_pt(uint256_t(blake2s_IV[3]));
 
     // Use the lookup tables to perform XORs
-    const auto lookup_1 =
-        plookup_read::get_lookup_accumulators(BLAKE_XOR, S.t[0], field_pt(uint256_t(blake2s_IV[4])), true);
-    v[12] = lookup_1[ColumnIdx::C3][0];
-    const auto lookup_2 =
-        plookup_read::get_lookup_accumulators(BLAKE_XOR, S.t[1], field_pt(uint256_t(blake2s_IV[5])), true);
-    v[13] = lookup_2[ColumnIdx::C3][0];
-    const auto lookup_3 =
-        plookup_read::get_lookup_accumulators(BLAKE_XOR, S.f[0], field_pt(uint256_t(blake2s_IV[6])), true);
-    v[14] = lookup_3[ColumnIdx::C3][0];
-    const auto lookup_4 =
-        plookup_read::get_lookup_accumulators(BLAKE_XOR, S.f[1], field_pt(uint256_t(blake2s_IV[7])), true);
-    v[15] = lookup_4[ColumnIdx::C3][0];
+    const std::array<field_pt, 4> xor_lhs{ S.t[0], S.t[1], S.f[0], S.f[1] };
+    const std::array<field_pt, 4> xor_rhs{
+        field_pt(uint256_t(blake2s_IV[4])),
+        field_pt(uint256_t(blake2s_IV[5])),
+        field_pt(uint256_t(blake2s_IV[6])),
+        field_pt(uint256_t(blake2s_IV[7])),
+    };
+    std::vector<plookup::ReadData<field_pt>> lookups;
+    plookup_read::get_batch_lookup_accumulators(BLAKE_XOR, xor_lhs, xor_rhs, true, lookups);
+    for (size_t i = 0; i < 4; ++i) {
+        v[12 + i] = lookups[i][ColumnIdx::C3][0];
+    }
 
     blake_util::round_fn_lookup<Composer>(v, m, 0);
     blake_util::round_fn_lookup<Composer>(v, m, 1);
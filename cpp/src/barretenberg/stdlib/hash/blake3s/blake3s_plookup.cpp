@@ -115,9 +115,12 @@ void blake3_compress_in_place(field_t<Composer> cv[8],
      * in the below loop, while reading from the lookup table, we ensure that the overflow is ignored and the result is
      * contrained to 32 bits.
      */
+    const std::span<const field_pt> xor_lhs(state, BLAKE3_STATE_SIZE >> 1);
+    const std::span<const field_pt> xor_rhs(state + (BLAKE3_STATE_SIZE >> 1), BLAKE3_STATE_SIZE >> 1);
+    std::vector<plookup::ReadData<field_pt>> lookups;
+    plookup_read::get_batch_lookup_accumulators(BLAKE_XOR, xor_lhs, xor_rhs, true, lookups);
     for (size_t i = 0; i < (BLAKE3_STATE_SIZE >> 1); i++) {
-        const auto lookup = plookup_read::get_lookup_accumulators(BLAKE_XOR, state[i], state[i + 8], true);
-        cv[i] = lookup[ColumnIdx::C3][0];
+        cv[i] = lookups[i][ColumnIdx::C3][0];
     }
 }
 
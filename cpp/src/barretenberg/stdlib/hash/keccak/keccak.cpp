@@ -432,8 +432,9 @@ template <typename Composer> void keccak<Composer>::chi(keccak_state& internal)
     // (cost = 12 * 25 = 300?)
     auto& state = internal.state;
 
+    std::array<field_ct, 5> lane_outputs;
+    std::vector<plookup::ReadData<field_ct>> lane_accumulators;
     for (size_t y = 0; y < 5; ++y) {
-        std::array<field_ct, 5> lane_outputs;
         for (size_t x = 0; x < 5; ++x) {
             const auto A = state[y * 5 + x];
             const auto B = state[y * 5 + ((x + 1) % 5)];
@@ -442,9 +443,10 @@ template <typename Composer> void keccak<Composer>::chi(keccak_state& internal)
             // vv should cost 1 gate
             lane_outputs[x] = (A + A + CHI_OFFSET).add_two(-B, C);
         }
+        // Normalize lane outputs and assign to internal.state
+        plookup_read::get_batch_lookup_accumulators(KECCAK_CHI_OUTPUT, lane_outputs, {}, false, lane_accumulators);
         for (size_t x = 0; x < 5; ++x) {
-            // Normalize lane outputs and assign to internal.state
-            auto accumulators = plookup_read::get_lookup_accumulators(KECCAK_CHI_OUTPUT, lane_outputs[x]);
+            const auto& accumulators = lane_accumulators[x];
             internal.state[y * 5 + x] = accumulators[ColumnIdx::C2][0];
             internal.state_msb[y * 5 + x] = accumulators[ColumnIdx::C3][accumulators[ColumnIdx::C3].size() - 1];
         }
@@ -740,8 +742,10 @@ stdlib::byte_array<Composer> keccak<Composer>::hash(byte_array_ct& input, const
     // populate keccak_state, convert our 64-bit lanes into an extended base-11 representation
     keccak_state internal;
     internal.context = ctx;
+    std::vector<plookup::ReadData<field_ct>> lane_accumulators;
+    plookup_read::get_batch_lookup_accumulators(KECCAK_FORMAT_INPUT, formatted_slices, {}, false, lane_accumulators);
     for (size_t i = 0; i < formatted_slices.size(); ++i) {
-        const auto accumulators = plookup_read::get_lookup_accumulators(KECCAK_FORMAT_INPUT, formatted_slices[i]);
+        const auto& accumulators = lane_accumulators[i];
         converted_buffer[i] = accumulators[ColumnIdx::C2][0];
         msb_buffer[i] = accumulators[ColumnIdx::C3][accumulators[ColumnIdx::C3].size() - 1];
     }
@@ -41,14 +41,14 @@ void prepare_constants(std::array<field_t<plonk::UltraComposer>, 8>& input)
     input[7] = init_constants[7];
 }
 
-sparse_witness_limbs convert_witness(const field_t<plonk::UltraComposer>& w)
+namespace {
+sparse_witness_limbs sparse_witness_limbs_from_lookup(const field_t<plonk::UltraComposer>& w,
+                                                      const ReadData<field_t<plonk::UltraComposer>>& lookup)
 {
     typedef field_t<plonk::UltraComposer> field_pt;
 
     sparse_witness_limbs result(w);
 
-    const auto lookup = plookup_read::get_lookup_accumulators(MultiTableId::SHA256_WITNESS_INPUT, w);
-
     result.sparse_limbs = std::array<field_pt, 4>{
         lookup[ColumnIdx::C2][0],
         lookup[ColumnIdx::C2][1],
@@ -65,6 +65,13 @@ sparse_witness_limbs convert_witness(const field_t<plonk::UltraComposer>& w)
 
     return result;
 }
+} // namespace
+
+sparse_witness_limbs convert_witness(const field_t<plonk::UltraComposer>& w)
+{
+    const auto lookup = plookup_read::get_lookup_accumulators(MultiTableId::SHA256_WITNESS_INPUT, w);
+    return sparse_witness_limbs_from_lookup(w, lookup);
+}
 
 std::array<field_t<plonk::UltraComposer>, 64> extend_witness(const std::array<field_t<plonk::UltraComposer>, 16>& w_in)
 {
@@ -80,6 +87,19 @@ std::array<field_t<plonk::UltraComposer>, 64> extend_witness(const std::array<fi
         }
     }
 
+    // Message words 1 to 15 are all converted to sparse form below (word 0 never is). Unlike the extended words, they
+    // don't depend on each other, so convert them in one batch up front
+    std::array<field_pt, 15> message_words;
+    for (size_t i = 0; i < 15; ++i) {
+        message_words[i] = w_in[i + 1];
+    }
+    std::vector<ReadData<field_pt>> message_word_lookups;
+    plookup_read::get_batch_lookup_accumulators(
+        MultiTableId::SHA256_WITNESS_INPUT, message_words, {}, false, message_word_lookups);
+    for (size_t i = 0; i < 15; ++i) {
+        w_sparse[i + 1] = sparse_witness_limbs_from_lookup(message_words[i], message_word_lookups[i]);
+    }
+
     for (size_t i = 16; i < 64; ++i) {
         auto& w_left = w_sparse[i - 15];
         auto& w_right = w_sparse[i - 2];
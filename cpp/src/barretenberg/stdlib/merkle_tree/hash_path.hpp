@@ -54,6 +54,113 @@ inline fr get_hash_path_root(fr_hash_path const& input)
     return hash_pair_native(input[input.size() - 1].first, input[input.size() - 1].second);
 }
 
+/**
+ * The shape of a membership proof for several leaves of one tree at once, which only holds each node it needs once.
+ *
+ * The nodes at height 0 are the leaves, in increasing index order, and the nodes at each height above are the parents
+ * of those below, in order. layout[h][i] is true when node i at height h is a left child whose sibling is node i + 1,
+ * so that the two are hashed together. Every other node is hashed with a sibling from the proof.
+ */
+typedef std::vector<std::vector<bool>> multi_hash_path_layout;
+
+/**
+ * A membership proof for several leaves of one tree (see multi_hash_path_layout). siblings holds the nodes that can't
+ * be computed from the leaves, from the leaves up and left to right within a height.
+ */
+struct fr_multi_hash_path {
+    multi_hash_path_layout layout;
+    std::vector<fr> siblings;
+};
+
+template <typename Ctx> struct multi_hash_path {
+    multi_hash_path_layout layout;
+    std::vector<field_t<Ctx>> siblings;
+};
+
+/**
+ * Walks the multi-hash path of the leaves at `indices`, which must be distinct and increasing, in a tree of `height`.
+ * Calls on_sibling(h, position) for every node at height h the proof has to provide, in the order of
+ * fr_multi_hash_path::siblings, and returns the layout.
+ */
+template <typename Index, typename OnSibling>
+multi_hash_path_layout walk_multi_hash_path(std::vector<Index> const& indices, size_t height, OnSibling&& on_sibling)
+{
+    for (size_t i = 1; i < indices.size(); ++i) {
+        ASSERT(indices[i - 1] < indices[i]);
+    }
+    multi_hash_path_layout layout(height);
+    std::vector<Index> positions = indices;
+    for (size_t h = 0; h < height; ++h) {
+        layout[h].resize(positions.size(), false);
+        std::vector<Index> parent_positions;
+        parent_positions.reserve(positions.size());
+        for (size_t i = 0; i < positions.size(); ++i) {
+            const Index position = positions[i];
+            if (!bool(position & 1) && i + 1 < positions.size() && positions[i + 1] == position + 1) {
+                layout[h][i] = true;
+                ++i;
+            } else {
+                on_sibling(h, position ^ 1);
+            }
+            parent_positions.push_back(position >> 1);
+        }
+        positions = std::move(parent_positions);
+    }
+    return layout;
+}
+
+template <typename Index>
+inline multi_hash_path_layout get_multi_hash_path_layout(std::vector<Index> const& indices, size_t height)
+{
+    return walk_multi_hash_path(indices, height, [](size_t, Index const&) {});
+}
+
+/**
+ * Computes the root from a multi-hash path and the leaves (in increasing index order) it was built for.
+ */
+inline fr get_multi_hash_path_root(fr_multi_hash_path const& path,
+                                   std::vector<fr> const& values,
+                                   std::vector<uint256_t> const& indices)
+{
+    ASSERT(values.size() > 0 && values.size() == indices.size());
+    std::vector<fr> nodes = values;
+    std::vector<uint256_t> positions = indices;
+    size_t sibling_index = 0;
+    for (auto const& layer : path.layout) {
+        ASSERT(layer.size() == nodes.size());
+        std::vector<fr> parents;
+        std::vector<uint256_t> parent_positions;
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            parent_positions.push_back(positions[i] >> 1);
+            if (layer[i]) {
+                ASSERT(!bool(positions[i] & 1) && positions[i + 1] == positions[i] + 1);
+                parents.push_back(hash_pair_native(nodes[i], nodes[i + 1]));
+                ++i;
+                continue;
+            }
+            ASSERT(sibling_index < path.siblings.size());
+            const fr& sibling = path.siblings[sibling_index++];
+            parents.push_back(bool(positions[i] & 1) ? hash_pair_native(sibling, nodes[i])
+                                                     : hash_pair_native(nodes[i], sibling));
+        }
+        nodes = std::move(parents);
+        positions = std::move(parent_positions);
+    }
+    ASSERT(nodes.size() == 1 && sibling_index == path.siblings.size());
+    return nodes[0];
+}
+
+template <typename Ctx>
+inline multi_hash_path<Ctx> create_witness_multi_hash_path(Ctx& ctx, fr_multi_hash_path const& input)
+{
+    multi_hash_path<Ctx> result{ input.layout, {} };
+    std::transform(
+        input.siblings.begin(), input.siblings.end(), std::back_inserter(result.siblings), [&](auto const& v) {
+            return field_t(witness_t(&ctx, v));
+        });
+    return result;
+}
+
 inline fr zero_hash_at_height(size_t height)
 {
     auto current = fr(0);
@@ -3,6 +3,7 @@
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/byte_array/byte_array.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <numeric>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -143,6 +144,109 @@ void assert_check_membership(field_t<Composer> const& root,
     exists.assert_equal(true, msg);
 }
 
+/**
+ * Computes the merkle root from a multi-hash path, hashing each node shared by the paths of the leaves only once.
+ *
+ * The layout is part of the circuit's shape, while the siblings and the indices are witnesses. Nodes that are hashed
+ * with a sibling from the proof are placed by the index bits of any leaf below them, as in compute_subtree_root. For
+ * nodes hashed with each other, the index bits of the leaves below them are constrained to make them siblings.
+ *
+ * @param path: The multi-hash path of the leaves,
+ * @param values: The values of the leaves, in increasing index order,
+ * @param indices: The indices of the leaves,
+ * @param is_updating_tree: set to true if we're updating the tree.
+ * @tparam Composer: type of composer.
+ */
+template <typename Composer>
+field_t<Composer> compute_multi_root(multi_hash_path<Composer> const& path,
+                                     std::vector<field_t<Composer>> const& values,
+                                     std::vector<bit_vector<Composer>> const& indices,
+                                     bool const is_updating_tree = false)
+{
+    ASSERT(values.size() > 0 && values.size() == indices.size());
+    const size_t depth = path.layout.size();
+    std::vector<field_t<Composer>> nodes = values;
+    // The leaf below each node whose index bits place it
+    std::vector<size_t> leaves(values.size());
+    std::iota(leaves.begin(), leaves.end(), 0);
+    size_t sibling_index = 0;
+    for (size_t h = 0; h < depth; ++h) {
+        ASSERT(path.layout[h].size() == nodes.size());
+        std::vector<field_t<Composer>> parents;
+        std::vector<size_t> parent_leaves;
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            parent_leaves.push_back(leaves[i]);
+            if (path.layout[h][i]) {
+                // The leaves below the two nodes have to agree on the path above them, and be left and right here
+                auto const& left_index = indices[leaves[i]];
+                auto const& right_index = indices[leaves[i + 1]];
+                left_index[h].assert_equal(false, "compute_multi_root: left node is not a left child");
+                right_index[h].assert_equal(true, "compute_multi_root: right node is not a right child");
+                for (size_t j = h + 1; j < depth; ++j) {
+                    left_index[j].assert_equal(right_index[j], "compute_multi_root: nodes are not siblings");
+                }
+                parents.push_back(
+                    pedersen_hash<Composer>::hash_multiple({ nodes[i], nodes[i + 1] }, 0, is_updating_tree));
+                ++i;
+                continue;
+            }
+            ASSERT(sibling_index < path.siblings.size());
+            auto const& sibling = path.siblings[sibling_index++];
+            bool_t<Composer> path_bit = indices[leaves[i]][h];
+            field_t<Composer> left = field_t<Composer>::conditional_assign(path_bit, sibling, nodes[i]);
+            field_t<Composer> right = field_t<Composer>::conditional_assign(path_bit, nodes[i], sibling);
+            parents.push_back(pedersen_hash<Composer>::hash_multiple({ left, right }, 0, is_updating_tree));
+        }
+        nodes = std::move(parents);
+        leaves = std::move(parent_leaves);
+    }
+    ASSERT(nodes.size() == 1 && sibling_index == path.siblings.size());
+    return nodes[0];
+}
+
+/**
+ * Checks if values are in a Merkle tree at the specified leaves.
+ *
+ * @param root: The root of the merkle tree,
+ * @param path: The multi-hash path of the leaves,
+ * @param values: The values of the leaves, in increasing index order,
+ * @param indices: The indices of the leaves,
+ * @param is_updating_tree: set to true if we're updating the tree.
+ * @tparam Composer: type of composer.
+ */
+template <typename Composer>
+bool_t<Composer> check_multi_membership(field_t<Composer> const& root,
+                                        multi_hash_path<Composer> const& path,
+                                        std::vector<field_t<Composer>> const& values,
+                                        std::vector<bit_vector<Composer>> const& indices,
+                                        bool const is_updating_tree = false)
+{
+    return (compute_multi_root(path, values, indices, is_updating_tree) == root);
+}
+
+/**
+ * Asserts if values are in a Merkle tree at the specified leaves.
+ *
+ * @param root: The root of the merkle tree,
+ * @param path: The multi-hash path of the leaves,
+ * @param values: The values of the leaves, in increasing index order,
+ * @param indices: The indices of the leaves,
+ * @param is_updating_tree: set to true if we're updating the tree,
+ * @param msg: error message.
+ * @tparam Composer: type of composer.
+ */
+template <typename Composer>
+void assert_check_multi_membership(field_t<Composer> const& root,
+                                   multi_hash_path<Composer> const& path,
+                                   std::vector<field_t<Composer>> const& values,
+                                   std::vector<bit_vector<Composer>> const& indices,
+                                   bool const is_updating_tree = false,
+                                   std::string const& msg = "assert_check_multi_membership")
+{
+    auto exists = check_multi_membership(root, path, values, indices, is_updating_tree);
+    exists.assert_equal(true, msg);
+}
+
 /**
  * Asserts if old and new state of the tree is correct after updating a single leaf.
  *
@@ -284,14 +388,82 @@ void assert_check_tree(field_t<Composer> const& root, std::vector<field_t<Compos
     valid.assert_equal(true, "assert_check_tree");
 }
 
+/**
+ * Computes the root of a subtree of `height` whose first leaves are `input` and whose other leaves are empty. Only the
+ * nodes with a non-empty leaf below them are hashed in the circuit; the others are zero hash constants.
+ *
+ * @param input: vector of leaf values, of size at most 2^height.
+ * @param height: The height of the subtree.
+ * @tparam Composer: type of composer.
+ */
+template <typename Composer>
+field_t<Composer> compute_padded_tree_root(std::vector<field_t<Composer>> const& input, size_t height)
+{
+    ASSERT(input.size() > 0);
+    ASSERT(input.size() <= (1UL << height));
+    auto layer = input;
+    auto zero_hash = fr(0);
+    for (size_t i = 0; i < height; ++i) {
+        if (layer.size() & 1) {
+            layer.push_back(field_t<Composer>(zero_hash));
+        }
+        std::vector<field_t<Composer>> next_layer(layer.size() / 2);
+        for (size_t j = 0; j < next_layer.size(); ++j) {
+            next_layer[j] = pedersen_hash<Composer>::hash_multiple({ layer[j * 2], layer[j * 2 + 1] });
+        }
+        layer = std::move(next_layer);
+        zero_hash = hash_pair_native(zero_hash, zero_hash);
+    }
+
+    return layer[0];
+}
+
+/**
+ * Asserts that the tree given by new_root is the empty subtree of `height` at start_index in the tree given by
+ * old_root, filled with new_values from its first leaf on.
+ *
+ * The subtree is hashed in the circuit, and then a single path of length depth - height is checked twice: for the
+ * empty subtree against the old root, and for the new subtree against the new root. Inserting k leaves one at a time
+ * with update_memberships costs 2 * k * depth hashes instead.
+ *
+ * @param new_root: The root of the updated merkle tree,
+ * @param old_root: The root of the merkle tree before it was updated,
+ * @param old_path: The hash path from any leaf in the subtree, computed before the tree was updated,
+ * @param new_values: The values to insert, at most 2^height of them,
+ * @param start_index: The index of the first leaf of the subtree, which has to be a multiple of 2^height,
+ * @param height: The height of the subtree,
+ * @param msg: error message.
+ * @tparam Composer: type of composer.
+ */
+template <typename Composer>
+void insert_subtree(field_t<Composer> const& new_root,
+                    field_t<Composer> const& old_root,
+                    hash_path<Composer> const& old_path,
+                    std::vector<field_t<Composer>> const& new_values,
+                    field_t<Composer> const& start_index,
+                    size_t height,
+                    std::string const& msg = "insert_subtree")
+{
+    auto index = start_index.decompose_into_bits();
+    // Only the bits above `height` place the subtree, so without this the values could land below another index
+    for (size_t i = 0; i < height; ++i) {
+        index[i].assert_equal(false, msg + "_start_index_alignment");
+    }
+
+    auto zero_subtree_root = field_t<Composer>(zero_hash_at_height(height));
+    auto subtree_root = compute_padded_tree_root(new_values, height);
+
+    update_subtree_membership(new_root, subtree_root, old_root, old_path, zero_subtree_root, index, height, msg);
+}
+
 /**
  * Updates the tree with a vector of new values starting from the leaf at start_index.
  *
  * @param new_root: The root of the updated merkle tree,
  * @param old_root: The root of the merkle tree before it was updated,
  * @param old_hashes: The hash path from the leaf at start_index, computed before the tree was updated
- * @param new_values: The vector of values to be inserted from start_index,
- * @param start_index: The index of any leaf from which new values are inserted,
+ * @param new_values: The vector of values to be inserted from start_index, whose size must be a power of 2,
+ * @param start_index: The index of the first leaf of the subtree the new values fill, a multiple of their number,
  * @param msg: error message.
  * @tparam Composer: type of composer.
  */
@@ -303,13 +475,9 @@ void batch_update_membership(field_t<Composer> const& new_root,
                              field_t<Composer> const& start_index,
                              std::string const& msg = "batch_update_membership")
 {
+    ASSERT(numeric::is_power_of_two(new_values.size()));
     size_t height = numeric::get_msb(new_values.size());
-    auto zero_subtree_root = field_t<Composer>(zero_hash_at_height(height));
-
-    auto rollup_root = compute_tree_root(new_values);
-
-    update_subtree_membership(
-        new_root, rollup_root, old_root, old_path, zero_subtree_root, start_index.decompose_into_bits(), height, msg);
+    insert_subtree(new_root, old_root, old_path, new_values, start_index, height, msg);
 }
 
 } // namespace merkle_tree
@@ -89,6 +89,55 @@ TEST(stdlib_merkle_tree, test_batch_update_membership)
     EXPECT_EQ(result, true);
 }
 
+TEST(stdlib_merkle_tree, test_insert_subtree)
+{
+    MemoryStore store;
+    MerkleTree db(store, 10);
+    auto composer = Composer();
+    for (size_t i = 0; i < 8; i++) {
+        db.update_element(i, fr::random_element());
+    }
+    // Define old state.
+    field_ct old_root = witness_ct(&composer, db.root());
+    auto old_hash_path = create_witness_hash_path(composer, db.get_hash_path(8));
+    // Fill 5 of the 8 leaves of the subtree at 8
+    std::vector<field_ct> values;
+    for (size_t i = 8; i < 13; i++) {
+        values.emplace_back(witness_ct(&composer, fr(i * 2)));
+        db.update_element(i, fr(i * 2));
+    }
+    // Define new state.
+    field_ct new_root = witness_ct(&composer, db.root());
+    field_ct start_idx = field_ct(witness_ct(&composer, fr(8)));
+    insert_subtree(new_root, old_root, old_hash_path, values, start_idx, 3);
+    EXPECT_EQ(composer.failed(), false);
+    auto prover = composer.create_prover();
+    printf("composer gates = %zu\n", composer.get_num_gates());
+    auto verifier = composer.create_verifier();
+    plonk::proof proof = prover.construct_proof();
+    bool result = verifier.verify_proof(proof);
+    EXPECT_EQ(result, true);
+}
+
+TEST(stdlib_merkle_tree, test_insert_subtree_unaligned_fail)
+{
+    MemoryStore store;
+    MerkleTree db(store, 10);
+    auto composer = Composer();
+    field_ct old_root = witness_ct(&composer, db.root());
+    auto old_hash_path = create_witness_hash_path(composer, db.get_hash_path(8));
+    std::vector<field_ct> values;
+    for (size_t i = 8; i < 12; i++) {
+        values.emplace_back(witness_ct(&composer, fr(i * 2)));
+        db.update_element(i, fr(i * 2));
+    }
+    field_ct new_root = witness_ct(&composer, db.root());
+    // The subtree is at 8, not 9
+    field_ct start_idx = field_ct(witness_ct(&composer, fr(9)));
+    insert_subtree(new_root, old_root, old_hash_path, values, start_idx, 2);
+    EXPECT_EQ(composer.failed(), true);
+}
+
 TEST(stdlib_merkle_tree, test_assert_check_membership)
 {
     MemoryStore store;
@@ -133,6 +182,69 @@ TEST(stdlib_merkle_tree, test_assert_check_membership_fail)
     bool result = verifier.verify_proof(proof);
     EXPECT_EQ(result, false);
 }
+TEST(stdlib_merkle_tree, test_check_multi_membership)
+{
+    MemoryStore store;
+    auto db = MerkleTree(store, 5);
+    for (size_t i = 0; i < 32; i += 3) {
+        db.update_element(i, fr::random_element());
+    }
+    auto composer = Composer();
+
+    const std::vector<size_t> leaves = { 0, 1, 6, 7, 9, 30 };
+    std::vector<MerkleTree<MemoryStore>::index_t> indices(leaves.begin(), leaves.end());
+    std::vector<field_ct> values;
+    std::vector<bit_vector<Composer>> index_bits;
+    for (auto leaf : leaves) {
+        auto bottom = db.get_hash_path(leaf)[0];
+        values.emplace_back(witness_ct(&composer, leaf & 1 ? bottom.second : bottom.first));
+        index_bits.emplace_back(field_ct(witness_ct(&composer, fr(leaf))).decompose_into_bits());
+    }
+    field_ct root = witness_ct(&composer, db.root());
+    auto path = create_witness_multi_hash_path(composer, db.get_multi_hash_path(indices));
+
+    bool_ct is_member = check_multi_membership(root, path, values, index_bits);
+
+    // A wrong value is not a member
+    auto wrong_values = values;
+    wrong_values[2] += 1;
+    bool_ct is_member_ = check_multi_membership(root, path, wrong_values, index_bits);
+
+    auto prover = composer.create_prover();
+    printf("composer gates = %zu\n", composer.get_num_gates());
+
+    auto verifier = composer.create_verifier();
+
+    plonk::proof proof = prover.construct_proof();
+
+    bool result = verifier.verify_proof(proof);
+    EXPECT_EQ(is_member.get_value(), true);
+    EXPECT_EQ(is_member_.get_value(), false);
+    EXPECT_EQ(result, true);
+}
+
+TEST(stdlib_merkle_tree, test_assert_check_multi_membership_fail)
+{
+    MemoryStore store;
+    auto db = MerkleTree(store, 3);
+    for (size_t i = 0; i < 8; ++i) {
+        db.update_element(i, fr(i + 1));
+    }
+    auto composer = Composer();
+
+    // Leaves 2 and 3 are hashed together, so claiming the second is at 5 breaks the circuit
+    auto path = create_witness_multi_hash_path(composer, db.get_multi_hash_path({ 2, 3 }));
+    std::vector<field_ct> values = { witness_ct(&composer, fr(3)), witness_ct(&composer, fr(4)) };
+    std::vector<bit_vector<Composer>> index_bits = {
+        field_ct(witness_ct(&composer, fr(2))).decompose_into_bits(),
+        field_ct(witness_ct(&composer, fr(5))).decompose_into_bits(),
+    };
+    field_ct root = witness_ct(&composer, db.root());
+
+    assert_check_multi_membership(root, path, values, index_bits);
+    EXPECT_EQ(composer.failed(), true);
+}
+
 // To test whether both old hash path and new hash path works for the same Merkle tree
 TEST(stdlib_merkle_tree, test_update_members)
 {
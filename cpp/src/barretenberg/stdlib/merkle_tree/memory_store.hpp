@@ -1,44 +1,159 @@
 #pragma once
 #include "hash_path.hpp"
 #include "barretenberg/common/streams.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 
 namespace proof_system::plonk {
 namespace stdlib {
 namespace merkle_tree {
 
+namespace memory_store_detail {
+
+/**
+ * The changes of one or more commits, over the versions before them (parent). Versions are immutable once published,
+ * so any number of readers can hold and read one while the writer publishes new ones.
+ */
+struct Version {
+    std::shared_ptr<const Version> parent;
+    std::map<std::string, std::string> puts;
+    std::set<std::string> deletes;
+
+    size_t size() const { return puts.size() + deletes.size(); }
+
+    static bool get(Version const* version, std::string const& key, std::vector<uint8_t>& value)
+    {
+        for (; version != nullptr; version = version->parent.get()) {
+            if (version->deletes.find(key) != version->deletes.end()) {
+                return false;
+            }
+            auto it = version->puts.find(key);
+            if (it != version->puts.end()) {
+                value = { it->second.begin(), it->second.end() };
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Squashes `newer` into its parent `older`. Deletes are kept as tombstones unless the result is the base version.
+     */
+    static std::shared_ptr<const Version> merge(Version const& older, Version const& newer)
+    {
+        auto merged = std::make_shared<Version>(older);
+        for (auto const& [key, value] : newer.puts) {
+            merged->puts[key] = value;
+            merged->deletes.erase(key);
+        }
+        for (auto const& key : newer.deletes) {
+            merged->puts.erase(key);
+            if (merged->parent != nullptr) {
+                merged->deletes.insert(key);
+            }
+        }
+        return merged;
+    }
+};
+
+inline std::string to_string(std::vector<uint8_t> const& input)
+{
+    return std::string((char*)input.data(), input.size());
+}
+
+} // namespace memory_store_detail
+
+/**
+ * A read-only view of a MemoryStore as of one of its commits, see MemoryStore::snapshot(). It is not affected by later
+ * commits, and can be read from any number of threads without locking.
+ */
+class MemoryStoreSnapshot {
+  public:
+    bool get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value) const
+    {
+        return memory_store_detail::Version::get(version_.get(), memory_store_detail::to_string(key), value);
+    }
+
+  private:
+    friend class MemoryStore;
+
+    explicit MemoryStoreSnapshot(std::shared_ptr<const memory_store_detail::Version> version)
+        : version_(std::move(version))
+    {}
+
+    std::shared_ptr<const memory_store_detail::Version> version_;
+};
+
+/**
+ * A key-value store with uncommitted changes that can be committed or rolled back.
+ *
+ * The committed state is a chain of immutable versions, one per commit, merged with their parents while they are at
+ * least as large (so that lookups go through a logarithmic number of them). A single writer thread uses put(), del(),
+ * get(), commit() and rollback(). Other threads read through snapshot()s, which keep the versions they see alive.
+ */
 class MemoryStore {
   public:
+    using Snapshot = MemoryStoreSnapshot;
+
     MemoryStore() {}
 
-    MemoryStore(MemoryStore const& rhs) = default;
-    MemoryStore(MemoryStore&& rhs) = default;
-    MemoryStore& operator=(MemoryStore const& rhs) = default;
-    MemoryStore& operator=(MemoryStore&& rhs) = default;
+    MemoryStore(MemoryStore const& rhs)
+        : head_(rhs.head())
+        , puts_(rhs.puts_)
+        , deletes_(rhs.deletes_)
+    {}
+    MemoryStore(MemoryStore&& rhs)
+        : head_(rhs.head())
+        , puts_(std::move(rhs.puts_))
+        , deletes_(std::move(rhs.deletes_))
+    {}
+    MemoryStore& operator=(MemoryStore const& rhs)
+    {
+        if (this != &rhs) {
+            publish(rhs.head());
+            puts_ = rhs.puts_;
+            deletes_ = rhs.deletes_;
+        }
+        return *this;
+    }
+    MemoryStore& operator=(MemoryStore&& rhs)
+    {
+        if (this != &rhs) {
+            publish(rhs.head());
+            puts_ = std::move(rhs.puts_);
+            deletes_ = std::move(rhs.deletes_);
+        }
+        return *this;
+    }
 
     bool put(std::vector<uint8_t> const& key, std::vector<uint8_t> const& value)
     {
-        auto key_str = to_string(key);
+        auto key_str = memory_store_detail::to_string(key);
         return put(key_str, value);
     }
 
     bool put(std::string const& key, std::vector<uint8_t> const& value)
     {
-        puts_[key] = to_string(value);
+        puts_[key] = memory_store_detail::to_string(value);
         deletes_.erase(key);
         return true;
     }
 
     bool del(std::vector<uint8_t> const& key)
     {
-        auto key_str = to_string(key);
+        auto key_str = memory_store_detail::to_string(key);
         puts_.erase(key_str);
         deletes_.insert(key_str);
         return true;
     };
 
-    bool get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value) { return get(to_string(key), value); }
+    bool get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value)
+    {
+        return get(memory_store_detail::to_string(key), value);
+    }
 
     bool get(std::string const& key, std::vector<uint8_t>& value)
     {
@@ -49,25 +164,25 @@ class MemoryStore {
         if (it != puts_.end()) {
             value = std::vector<uint8_t>(it->second.begin(), it->second.end());
             return true;
-        } else {
-            std::string result;
-            auto it = store_.find(key);
-            if (it != store_.end()) {
-                value = { it->second.begin(), it->second.end() };
-                return true;
-            }
-            return false;
         }
+        // Only the writer replaces head_, so it can read it without the lock
+        return memory_store_detail::Version::get(head_.get(), key, value);
     }
 
     void commit()
     {
-        for (auto it : puts_) {
-            store_.insert(it);
+        if (puts_.empty() && deletes_.empty()) {
+            return;
         }
-        for (auto key : deletes_) {
-            store_.erase(key);
+        auto version = std::make_shared<memory_store_detail::Version>();
+        version->parent = head_;
+        version->puts = std::move(puts_);
+        version->deletes = std::move(deletes_);
+        std::shared_ptr<const memory_store_detail::Version> new_head = version;
+        while (new_head->parent != nullptr && new_head->parent->size() <= new_head->size()) {
+            new_head = memory_store_detail::Version::merge(*new_head->parent, *new_head);
         }
+        publish(std::move(new_head));
         puts_.clear();
         deletes_.clear();
     }
@@ -78,10 +193,28 @@ class MemoryStore {
         deletes_.clear();
     }
 
+    /**
+     * A read-only view of the store as of the last commit, which later commits don't change. Unlike the store itself,
+     * it can be read from other threads than the writer's.
+     */
+    Snapshot snapshot() const { return Snapshot(head()); }
+
   private:
-    std::string to_string(std::vector<uint8_t> const& input) { return std::string((char*)input.data(), input.size()); }
+    std::shared_ptr<const memory_store_detail::Version> head() const
+    {
+        std::lock_guard<std::mutex> lock(head_mutex_);
+        return head_;
+    }
+
+    void publish(std::shared_ptr<const memory_store_detail::Version> head)
+    {
+        std::lock_guard<std::mutex> lock(head_mutex_);
+        head_ = std::move(head);
+    }
 
-    std::map<std::string, std::string> store_;
+    // Guards replacing and copying head_, not the versions it points to
+    mutable std::mutex head_mutex_;
+    std::shared_ptr<const memory_store_detail::Version> head_;
     std::map<std::string, std::string> puts_;
     std::set<std::string> deletes_;
 };
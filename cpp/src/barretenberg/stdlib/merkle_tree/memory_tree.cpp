@@ -58,6 +58,20 @@ fr_sibling_path MemoryTree::get_sibling_path(size_t index)
     return path;
 }
 
+fr_multi_hash_path MemoryTree::get_multi_hash_path(std::vector<size_t> const& indices)
+{
+    // Offset of the first node at each height in hashes_
+    std::vector<size_t> offsets(depth_);
+    for (size_t i = 1; i < depth_; ++i) {
+        offsets[i] = offsets[i - 1] + (total_size_ >> (i - 1));
+    }
+    fr_multi_hash_path path;
+    path.layout = walk_multi_hash_path(indices, depth_, [&](size_t height, size_t position) {
+        path.siblings.push_back(hashes_[offsets[height] + position]);
+    });
+    return path;
+}
+
 fr MemoryTree::update_element(size_t index, fr const& value)
 {
     size_t offset = 0;
@@ -32,6 +32,12 @@ class MemoryTree {
 
     fr_sibling_path get_sibling_path(size_t index);
 
+    /**
+     * The membership proof of all the leaves at `indices` (distinct, in increasing order), where nodes shared between
+     * their paths are only included once.
+     */
+    fr_multi_hash_path get_multi_hash_path(std::vector<size_t> const& indices);
+
     fr update_element(size_t index, fr const& value);
 
     fr root() const { return root_; }
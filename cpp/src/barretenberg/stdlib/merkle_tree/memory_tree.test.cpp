@@ -78,3 +78,38 @@ TEST(stdlib_merkle_tree, test_memory_store_sibling_path)
     EXPECT_EQ(db.get_sibling_path(3), expected03);
     EXPECT_EQ(db.root(), root);
 }
+
+TEST(stdlib_merkle_tree, test_memory_store_multi_hash_path)
+{
+    fr e00 = 0;
+    fr e01 = VALUES[1];
+    fr e02 = VALUES[2];
+    fr e03 = VALUES[3];
+    fr e10 = hash_pair_native(e00, e01);
+    fr e11 = hash_pair_native(e02, e03);
+    fr root = hash_pair_native(e10, e11);
+
+    MemoryTree db(2);
+    for (size_t i = 0; i < 4; ++i) {
+        db.update_element(i, VALUES[i]);
+    }
+
+    // Leaves 0 and 1 are hashed together, and so are their parent and that of leaf 3. Only leaf 2 is needed
+    auto path = db.get_multi_hash_path({ 0, 1, 3 });
+    multi_hash_path_layout expected_layout = { { true, false, false }, { true, false } };
+    EXPECT_EQ(path.layout, expected_layout);
+    EXPECT_EQ(path.siblings, std::vector<fr>({ e02 }));
+    EXPECT_EQ(get_multi_hash_path_root(path, { e00, e01, e03 }, { 0, 1, 3 }), root);
+
+    // Leaves with no shared parent need a sibling each, until their paths meet
+    path = db.get_multi_hash_path({ 1, 2 });
+    expected_layout = { { false, false }, { true, false } };
+    EXPECT_EQ(path.layout, expected_layout);
+    EXPECT_EQ(path.siblings, std::vector<fr>({ e00, e03 }));
+    EXPECT_EQ(get_multi_hash_path_root(path, { e01, e02 }, { 1, 2 }), root);
+
+    // A single leaf's multi-hash path is its sibling path
+    path = db.get_multi_hash_path({ 2 });
+    EXPECT_EQ(path.siblings, db.get_sibling_path(2));
+    EXPECT_EQ(get_multi_hash_path_root(path, { e02 }, { 2 }), root);
+}
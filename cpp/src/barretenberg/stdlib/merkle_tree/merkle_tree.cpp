@@ -133,6 +133,84 @@ template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t
     return path;
 }
 
+template <typename Store>
+fr_multi_hash_path MerkleTree<Store>::get_multi_hash_path(std::vector<index_t> const& indices)
+{
+    ASSERT(indices.size() > 0);
+    fr_multi_hash_path path;
+    path.layout = get_multi_hash_path_layout(indices, depth_);
+
+    // The traversal is depth first, left to right, so siblings are appended to each height in order
+    std::vector<std::vector<fr>> siblings(depth_);
+    get_multi_hash_path(root(), indices, 0, indices.size(), depth_, siblings);
+    for (auto& height_siblings : siblings) {
+        path.siblings.insert(path.siblings.end(), height_siblings.begin(), height_siblings.end());
+    }
+    return path;
+}
+
+template <typename Store>
+void MerkleTree<Store>::get_multi_hash_path(fr const& root,
+                                            std::vector<index_t> const& indices,
+                                            size_t begin,
+                                            size_t end,
+                                            size_t height,
+                                            std::vector<std::vector<fr>>& siblings)
+{
+    if (height == 0) {
+        return;
+    }
+
+    std::vector<uint8_t> data;
+    bool status = store_.get(root.to_buffer(), data);
+
+    if (!status || data.size() == 65) {
+        // This is an empty subtree, or a stump: a subtree with a single non-empty leaf. Every node in it is either a
+        // zero hash or on the path of that leaf, so the siblings can be filled in without visiting the store again.
+        std::vector<index_t> subtree_indices;
+        subtree_indices.reserve(end - begin);
+        for (size_t i = begin; i < end; ++i) {
+            subtree_indices.push_back(numeric::keep_n_lsb(indices[i], height));
+        }
+        std::vector<fr> element_path;
+        index_t element_index = 0;
+        if (status) {
+            element_index = from_buffer<index_t>(data, 32);
+            element_path.push_back(from_buffer<fr>(data, 0));
+            for (size_t i = 0; i + 1 < height; ++i) {
+                bool is_right = bit_set(element_index, i);
+                element_path.push_back(is_right ? hash_pair_native(zero_hashes_[i], element_path[i])
+                                                : hash_pair_native(element_path[i], zero_hashes_[i]));
+            }
+        }
+        walk_multi_hash_path(subtree_indices, height, [&](size_t h, index_t const& position) {
+            bool on_element_path = status && position == (element_index >> h);
+            siblings[h].push_back(on_element_path ? element_path[h] : zero_hashes_[h]);
+        });
+        return;
+    }
+
+    // This is a regular node with left and right trees. Split the indices between them, and descend into those with
+    // any. The other one is a sibling.
+    ASSERT(data.size() == 64);
+    auto left = from_buffer<fr>(data, 0);
+    auto right = from_buffer<fr>(data, 32);
+    size_t split = begin;
+    while (split < end && !bit_set(indices[split], height - 1)) {
+        ++split;
+    }
+    if (split > begin) {
+        get_multi_hash_path(left, indices, begin, split, height - 1, siblings);
+    } else {
+        siblings[height - 1].push_back(left);
+    }
+    if (end > split) {
+        get_multi_hash_path(right, indices, split, end, height - 1, siblings);
+    } else {
+        siblings[height - 1].push_back(right);
+    }
+}
+
 template <typename Store> fr MerkleTree<Store>::update_element(index_t index, fr const& value)
 {
     auto leaf = value;
@@ -289,6 +367,7 @@ template <typename Store> void MerkleTree<Store>::remove(fr const& key)
 }
 
 template class MerkleTree<MemoryStore>;
+MERKLE_TREE_INSTANTIATE_READ_ONLY(, MemoryStoreSnapshot)
 
 } // namespace merkle_tree
 } // namespace stdlib
@@ -9,18 +9,48 @@ namespace merkle_tree {
 using namespace barretenberg;
 
 class MemoryStore;
-
+class MemoryStoreSnapshot;
+
+/**
+ * A sparse Merkle tree over a key-value store, where a node's key is its hash.
+ *
+ * Nodes don't change once written, so a tree over a MemoryStoreSnapshot is a consistent, read-only view of the tree
+ * as of a commit of its MemoryStore, addressed by its root:
+ *
+ *   auto snapshot = store.snapshot();
+ *   MerkleTree<MemoryStoreSnapshot> view(snapshot, tree);
+ *
+ * Any number of threads can read such a view while a single writer updates the tree and commits the store.
+ */
 template <typename Store> class MerkleTree {
   public:
     typedef uint256_t index_t;
 
     MerkleTree(Store& store, size_t depth, uint8_t tree_id = 0);
+
+    /**
+     * A tree with the depth and id of `other`, over another store, e.g. a snapshot of other's store. Saves
+     * recomputing the zero hashes.
+     */
+    template <typename OtherStore>
+    MerkleTree(Store& store, MerkleTree<OtherStore> const& other)
+        : store_(store)
+        , zero_hashes_(other.zero_hashes_)
+        , depth_(other.depth_)
+        , tree_id_(other.tree_id_)
+    {}
     MerkleTree(MerkleTree const& other) = delete;
     MerkleTree(MerkleTree&& other);
     ~MerkleTree();
 
     fr_hash_path get_hash_path(index_t index);
 
+    /**
+     * The membership proof of all the leaves at `indices` (distinct, in increasing order), where nodes shared between
+     * their paths are only included once. Each node of the store on the way is read once.
+     */
+    fr_multi_hash_path get_multi_hash_path(std::vector<index_t> const& indices);
+
     fr update_element(index_t index, fr const& value);
 
     fr root() const;
@@ -30,6 +60,8 @@ template <typename Store> class MerkleTree {
     index_t size() const;
 
   protected:
+    template <typename> friend class MerkleTree;
+
     void load_metadata();
 
     /**
@@ -45,6 +77,17 @@ template <typename Store> class MerkleTree {
 
     fr get_element(fr const& root, index_t index, size_t height);
 
+    /**
+     * Appends the siblings of the multi-hash path of indices[begin..end) within the subtree at `root`, of `height`, to
+     * siblings[h] for each height h below it.
+     */
+    void get_multi_hash_path(fr const& root,
+                             std::vector<index_t> const& indices,
+                             size_t begin,
+                             size_t end,
+                             size_t height,
+                             std::vector<std::vector<fr>>& siblings);
+
     /**
      * Computes the root hash of a tree of `height`, that is empty other than `value` at `index`.
      *
@@ -95,7 +138,21 @@ template <typename Store> class MerkleTree {
     uint8_t tree_id_;
 };
 
+// A snapshot can't be written to, so only the read paths of a tree over one are instantiated.
+#define MERKLE_TREE_INSTANTIATE_READ_ONLY(extern_, Store)                                                              \
+    extern_ template MerkleTree<Store>::MerkleTree(Store&, size_t, uint8_t);                                           \
+    extern_ template MerkleTree<Store>::MerkleTree(MerkleTree&&);                                                      \
+    extern_ template MerkleTree<Store>::~MerkleTree();                                                                 \
+    extern_ template fr_hash_path MerkleTree<Store>::get_hash_path(uint256_t);                                         \
+    extern_ template fr_multi_hash_path MerkleTree<Store>::get_multi_hash_path(std::vector<uint256_t> const&);         \
+    extern_ template void MerkleTree<Store>::get_multi_hash_path(                                                      \
+        fr const&, std::vector<uint256_t> const&, size_t, size_t, size_t, std::vector<std::vector<fr>>&);              \
+    extern_ template fr MerkleTree<Store>::root() const;                                                               \
+    extern_ template uint256_t MerkleTree<Store>::size() const;                                                        \
+    extern_ template fr MerkleTree<Store>::compute_zero_path_hash(size_t, uint256_t, fr const&);
+
 extern template class MerkleTree<MemoryStore>;
+MERKLE_TREE_INSTANTIATE_READ_ONLY(extern, MemoryStoreSnapshot)
 
 } // namespace merkle_tree
 } // namespace stdlib
@@ -5,6 +5,9 @@
 #include "barretenberg/common/test.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 
+#include <atomic>
+#include <thread>
+
 namespace proof_system::test_stdlib_merkle_tree {
 
 using namespace plonk::stdlib;
@@ -135,4 +138,149 @@ TEST(stdlib_merkle_tree, test_get_hash_path_layers)
         EXPECT_NE(before[2], after[2]);
     }
 }
+
+TEST(stdlib_merkle_tree, test_get_multi_hash_path)
+{
+    constexpr size_t depth = 10;
+    MemoryTree memdb(depth);
+
+    MemoryStore store;
+    auto db = MerkleTree(store, depth);
+
+    std::random_device rd;
+    std::mt19937 g(rd());
+    auto check_multi_hash_paths = [&]() {
+        for (size_t num_leaves : { 1UL, 2UL, 17UL, 100UL }) {
+            std::vector<size_t> leaves(1 << depth);
+            std::iota(leaves.begin(), leaves.end(), 0);
+            std::shuffle(leaves.begin(), leaves.end(), g);
+            leaves.resize(num_leaves);
+            std::sort(leaves.begin(), leaves.end());
+
+            std::vector<MerkleTree<MemoryStore>::index_t> indices(leaves.begin(), leaves.end());
+            std::vector<uint256_t> root_indices(leaves.begin(), leaves.end());
+            std::vector<fr> values;
+            size_t num_path_siblings = 0;
+            for (auto leaf : leaves) {
+                auto bottom = memdb.get_hash_path(leaf)[0];
+                values.push_back(leaf & 1 ? bottom.second : bottom.first);
+                num_path_siblings += depth;
+            }
+
+            auto path = db.get_multi_hash_path(indices);
+            EXPECT_EQ(path.layout, memdb.get_multi_hash_path(leaves).layout);
+            EXPECT_EQ(path.siblings, memdb.get_multi_hash_path(leaves).siblings);
+            EXPECT_EQ(get_multi_hash_path_root(path, values, root_indices), db.root());
+            EXPECT_LE(path.siblings.size(), num_path_siblings);
+        }
+    };
+
+    // An empty tree, a single stump, a few stumps, and a full tree
+    check_multi_hash_paths();
+    memdb.update_element(512, VALUES[512]);
+    db.update_element(512, VALUES[512]);
+    check_multi_hash_paths();
+    for (size_t i : { 3UL, 4UL, 100UL, 513UL, 1000UL }) {
+        memdb.update_element(i, VALUES[i]);
+        db.update_element(i, VALUES[i]);
+    }
+    check_multi_hash_paths();
+    for (size_t i = 0; i < 1024; ++i) {
+        memdb.update_element(i, VALUES[i]);
+        db.update_element(i, VALUES[i]);
+    }
+    check_multi_hash_paths();
+}
+
+TEST(stdlib_merkle_tree, test_snapshot)
+{
+    constexpr size_t depth = 10;
+    MemoryStore store;
+    auto db = MerkleTree(store, depth);
+
+    for (size_t i = 0; i < 10; ++i) {
+        db.update_element(i, VALUES[i]);
+    }
+    // Nothing is committed yet
+    auto empty_snapshot = store.snapshot();
+    MerkleTree<MemoryStoreSnapshot> empty_view(empty_snapshot, db);
+    EXPECT_EQ(empty_view.root(), zero_hash_at_height(depth));
+    EXPECT_EQ(empty_view.size(), 0ULL);
+
+    store.commit();
+    auto snapshot = store.snapshot();
+    MerkleTree<MemoryStoreSnapshot> view(snapshot, db);
+    const fr root = db.root();
+    std::vector<fr_hash_path> paths;
+    for (size_t i = 0; i < 16; ++i) {
+        paths.push_back(db.get_hash_path(i));
+    }
+    EXPECT_EQ(view.root(), root);
+    EXPECT_EQ(view.size(), 10ULL);
+
+    // Later updates, which remove the nodes of the old root from the store, and commits don't change the view
+    for (size_t i = 0; i < 1024; ++i) {
+        db.update_element(i, VALUES[(i * 7) % 1024]);
+        if (i % 100 == 0) {
+            store.commit();
+        }
+    }
+    store.commit();
+    EXPECT_NE(db.root(), root);
+    EXPECT_EQ(view.root(), root);
+    EXPECT_EQ(view.size(), 10ULL);
+    for (size_t i = 0; i < 16; ++i) {
+        EXPECT_EQ(view.get_hash_path(i), paths[i]);
+    }
+
+    // While a new snapshot sees them
+    auto new_snapshot = store.snapshot();
+    MerkleTree<MemoryStoreSnapshot> new_view(new_snapshot, db);
+    EXPECT_EQ(new_view.root(), db.root());
+    EXPECT_EQ(new_view.get_hash_path(512), db.get_hash_path(512));
+}
+
+#ifndef NO_MULTITHREADING
+TEST(stdlib_merkle_tree, test_snapshot_concurrent_readers)
+{
+    constexpr size_t depth = 10;
+    constexpr size_t num_blocks = 8;
+    constexpr size_t block_size = 32;
+    MemoryStore store;
+    auto db = MerkleTree(store, depth);
+
+    // Readers check that every path they read from a snapshot leads to the snapshot's root, while the writer appends
+    // blocks of leaves and commits them
+    std::atomic<bool> done = false;
+    std::atomic<size_t> num_bad_paths = 0;
+    std::vector<std::thread> readers;
+    for (size_t t = 0; t < 4; ++t) {
+        readers.emplace_back([&, t]() {
+            size_t index = t;
+            while (!done) {
+                auto snapshot = store.snapshot();
+                MerkleTree<MemoryStoreSnapshot> view(snapshot, db);
+                const fr root = view.root();
+                for (size_t i = 0; i < 4; ++i) {
+                    index = (index * 31 + 7) % (num_blocks * block_size);
+                    if (get_hash_path_root(view.get_hash_path(index)) != root) {
+                        ++num_bad_paths;
+                    }
+                }
+            }
+        });
+    }
+    for (size_t block = 0; block < num_blocks; ++block) {
+        for (size_t i = 0; i < block_size; ++i) {
+            db.update_element(block * block_size + i, VALUES[block * block_size + i]);
+        }
+        store.commit();
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(num_bad_paths, 0UL);
+}
+#endif
 } // namespace proof_system::test_stdlib_merkle_tree
\ No newline at end of file
@@ -178,6 +178,9 @@ template <class Composer, class Fq, class Fr, class NativeGroup> class element {
     // only works with Plookup!
     template <size_t max_num_bits = 0>
     static element wnaf_batch_mul(const std::vector<element>& points, const std::vector<Fr>& scalars);
+    // With Plookup, full-width multiplications of one or two witness points are dispatched to wnaf_batch_mul, whose
+    // per-point tables of multiples live in ROM and cost a handful of gates per read (see `all_witnesses`). From three
+    // points on, the multi-point tables of the generic path are cheaper
     static element batch_mul(const std::vector<element>& points,
                              const std::vector<Fr>& scalars,
                              const size_t max_num_bits = 0);
@@ -214,6 +217,27 @@ template <class Composer, class Fq, class Fr, class NativeGroup> class element {
 
     static std::vector<bool_t<Composer>> compute_naf(const Fr& scalar, const size_t max_num_bits = 0);
 
+    // ROM-backed point tables need a composer context, so they can only be built when no input is a circuit constant.
+    // Bigfield scalars are excluded: wnaf_batch_mul's wNAF of a bigfield scalar is not exercised anywhere. In-circuit
+    // ECDSA is unaffected either way, as it goes through secp256k1_ecdsa_mul rather than batch_mul or operator*.
+    static bool all_witnesses(const std::vector<element>& points, const std::vector<Fr>& scalars)
+    {
+        if constexpr (!std::is_same<Fr, field_t<Composer>>::value) {
+            return false;
+        }
+        for (const auto& point : points) {
+            if (point.x.is_constant() || point.y.is_constant()) {
+                return false;
+            }
+        }
+        for (const auto& scalar : scalars) {
+            if (scalar.is_constant()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     template <size_t max_num_bits = 0, size_t WNAF_SIZE = 4>
     static std::vector<field_t<Composer>> compute_wnaf(const Fr& scalar);
 
@@ -474,7 +498,7 @@ template <class Composer, class Fq, class Fr, class NativeGroup> class element {
             num_fives = num_points / 5;
             num_sixes = 0;
             // size-6 table is expensive and only benefits us if creating them reduces the number of total tables
-            if (num_fives * 5 == (num_points - 1)) {
+            if (num_fives * 5 == (num_points - 1) && num_fives >= 1) {
                 num_fives -= 1;
                 num_sixes = 1;
             } else if (num_fives * 5 == (num_points - 2) && num_fives >= 2) {
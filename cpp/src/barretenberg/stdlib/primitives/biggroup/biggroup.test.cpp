@@ -344,9 +344,8 @@ template <typename TestType> class stdlib_biggroup : public testing::Test {
         EXPECT_VERIFICATION(composer);
     }
 
-    static void test_batch_mul()
+    static void test_batch_mul(const size_t num_points = 5)
     {
-        const size_t num_points = 5;
         auto composer = Composer("../srs_db/ignition/");
         std::vector<affine_element> points;
         std::vector<fr> scalars;
@@ -883,6 +882,12 @@ HEAVY_TYPED_TEST(stdlib_biggroup, batch_mul)
 {
     TestFixture::test_batch_mul();
 }
+HEAVY_TYPED_TEST(stdlib_biggroup, batch_mul_few_points)
+{
+    for (size_t num_points = 1; num_points < 4; ++num_points) {
+        TestFixture::test_batch_mul(num_points);
+    }
+}
 HEAVY_TYPED_TEST(stdlib_biggroup, chain_add)
 {
 
@@ -998,4 +1003,64 @@ HEAVY_TYPED_TEST(stdlib_biggroup, ecdsa_mul_secp256k1)
         GTEST_SKIP();
     }
 }
+
+/* None of the types above is an UltraComposer curve with a native scalar field, which is the only case in which
+   operator* and batch_mul dispatch to wnaf_batch_mul. Check the dispatched results, and that they take fewer gates than
+   the generic path (forced by passing the full scalar width). */
+HEAVY_TEST(stdlib_biggroup_ultra, few_points_gate_count)
+{
+    using Curve = stdlib::bn254<UltraComposer>;
+    using element_ct = Curve::g1_ct;
+    using scalar_ct = Curve::fr_ct;
+    using fq = Curve::fq;
+    using fr = Curve::fr;
+    using g1 = Curve::g1;
+    using affine_element = g1::affine_element;
+    using element = g1::element;
+    constexpr size_t full_width = fr::modulus.get_msb() + 1;
+
+    // Gates added by `mul` over num_points random witness points and scalars, checking its result
+    const auto count_gates = [](const size_t num_points, const auto& mul) {
+        UltraComposer composer;
+        std::vector<element_ct> circuit_points;
+        std::vector<scalar_ct> circuit_scalars;
+        element expected = g1::one;
+        expected.self_set_infinity();
+        for (size_t i = 0; i < num_points; ++i) {
+            const affine_element point(element::random_element());
+            const fr scalar = fr::random_element();
+            circuit_points.push_back(element_ct::from_witness(&composer, point));
+            circuit_scalars.push_back(scalar_ct::from_witness(&composer, scalar));
+            expected += element(point) * scalar;
+        }
+        const size_t before = composer.get_num_gates();
+        const element_ct result = mul(circuit_points, circuit_scalars);
+        const size_t gates = composer.get_num_gates() - before;
+
+        const affine_element expected_affine(expected);
+        EXPECT_EQ(fq(result.x.get_value().lo), expected_affine.x);
+        EXPECT_EQ(fq(result.y.get_value().lo), expected_affine.y);
+        EXPECT_FALSE(composer.failed());
+        return gates;
+    };
+    const auto mul = [](const auto& points, const auto& scalars) { return points[0] * scalars[0]; };
+    const auto batch_mul = [](const auto& points, const auto& scalars) {
+        return element_ct::batch_mul(points, scalars);
+    };
+    const auto generic_batch_mul = [](const auto& points, const auto& scalars) {
+        return element_ct::batch_mul(points, scalars, full_width);
+    };
+
+    benchmark_info("UltraPlonk", "Biggroup", "MUL", "Gate Count", count_gates(1, mul));
+    for (size_t num_points = 1; num_points < 4; ++num_points) {
+        const size_t gates = count_gates(num_points, batch_mul);
+        const size_t generic_gates = count_gates(num_points, generic_batch_mul);
+        info("batch_mul of ", num_points, " points: ", gates, " gates, generic path ", generic_gates, " gates");
+        if (num_points < 3) {
+            EXPECT_LT(gates, generic_gates);
+        } else {
+            EXPECT_EQ(gates, generic_gates);
+        }
+    }
+}
 } // namespace test_stdlib_biggroup
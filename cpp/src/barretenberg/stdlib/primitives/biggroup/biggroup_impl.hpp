@@ -604,6 +604,11 @@ element<C, Fq, Fr, G> element<C, Fq, Fr, G>::batch_mul(const std::vector<element
 
     const size_t num_points = points.size();
     ASSERT(scalars.size() == num_points);
+    if constexpr (C::type == ComposerType::PLOOKUP) {
+        if (max_num_bits == 0 && num_points < 3 && all_witnesses(points, scalars)) {
+            return wnaf_batch_mul(points, scalars);
+        }
+    }
     batch_lookup_table point_table(points);
     const size_t num_rounds = (max_num_bits == 0) ? Fr::modulus.get_msb() + 1 : max_num_bits;
 
@@ -648,6 +653,7 @@ element<C, Fq, Fr, G> element<C, Fq, Fr, G>::batch_mul(const std::vector<element
  * Implements scalar multiplication.
  *
  * For multiple scalar multiplication use one of the `batch_mul` methods to save gates.
+ * With Plookup, witness inputs use the windowed `wnaf_batch_mul`, reading point multiples out of a ROM table.
  **/
 template <typename C, class Fq, class Fr, class G>
 element<C, Fq, Fr, G> element<C, Fq, Fr, G>::operator*(const Fr& scalar) const
@@ -675,6 +681,12 @@ element<C, Fq, Fr, G> element<C, Fq, Fr, G>::operator*(const Fr& scalar) const
      * specifics.
      *
      **/
+    if constexpr (C::type == ComposerType::PLOOKUP) {
+        if (all_witnesses({ *this }, { scalar })) {
+            return wnaf_batch_mul({ *this }, { scalar });
+        }
+    }
+
     constexpr uint64_t num_rounds = Fr::modulus.get_msb() + 1;
 
     std::vector<bool_t<C>> naf_entries = compute_naf(scalar);
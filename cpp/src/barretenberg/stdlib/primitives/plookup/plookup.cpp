@@ -14,22 +14,30 @@ using plookup::ColumnIdx;
 using plookup::MultiTableId;
 using namespace barretenberg;
 
+/**
+ * @brief Turn natively computed accumulators for (key_a, key_b) into circuit values in `lookup`, adding lookup gates
+ * unless both keys are constant. Keys must already be normalized.
+ */
 template <typename Composer>
-plookup::ReadData<field_t<Composer>> plookup_<Composer>::get_lookup_accumulators(const MultiTableId id,
-                                                                                 const field_t<Composer>& key_a_in,
-                                                                                 const field_t<Composer>& key_b_in,
-                                                                                 const bool is_2_to_1_lookup)
+void plookup_<Composer>::create_lookup_witnesses(const MultiTableId id,
+                                                 const field_t<Composer>& key_a,
+                                                 const field_t<Composer>& key_b,
+                                                 const bool is_2_to_1_lookup,
+                                                 const plookup::ReadData<barretenberg::fr>& lookup_data,
+                                                 plookup::ReadData<field_t<Composer>>& lookup)
 {
-    auto key_a = key_a_in.normalize();
-    auto key_b = key_b_in.normalize();
     Composer* ctx = key_a.get_context() ? key_a.get_context() : key_b.get_context();
-    const plookup::ReadData<barretenberg::fr> lookup_data =
-        plookup::get_lookup_accumulators(id, key_a.get_value(), key_b.get_value(), is_2_to_1_lookup);
 
     const bool is_key_a_constant = key_a.is_constant();
-    plookup::ReadData<field_t<Composer>> lookup;
+    const size_t num_lookups = lookup_data[ColumnIdx::C1].size();
+    lookup[ColumnIdx::C1].clear();
+    lookup[ColumnIdx::C2].clear();
+    lookup[ColumnIdx::C3].clear();
+    lookup[ColumnIdx::C1].reserve(num_lookups);
+    lookup[ColumnIdx::C2].reserve(num_lookups);
+    lookup[ColumnIdx::C3].reserve(num_lookups);
     if (is_key_a_constant && (key_b.is_constant() || !is_2_to_1_lookup)) {
-        for (size_t i = 0; i < lookup_data[ColumnIdx::C1].size(); ++i) {
+        for (size_t i = 0; i < num_lookups; ++i) {
             lookup[ColumnIdx::C1].emplace_back(field_t<Composer>(ctx, lookup_data[ColumnIdx::C1][i]));
             lookup[ColumnIdx::C2].emplace_back(field_t<Composer>(ctx, lookup_data[ColumnIdx::C2][i]));
             lookup[ColumnIdx::C3].emplace_back(field_t<Composer>(ctx, lookup_data[ColumnIdx::C3][i]));
@@ -52,7 +60,7 @@ plookup::ReadData<field_t<Composer>> plookup_<Composer>::get_lookup_accumulators
         const auto accumulator_witnesses =
             ctx->create_gates_from_plookup_accumulators(id, lookup_data, lhs_index, key_b_witness);
 
-        for (size_t i = 0; i < lookup_data[ColumnIdx::C1].size(); ++i) {
+        for (size_t i = 0; i < num_lookups; ++i) {
             lookup[ColumnIdx::C1].emplace_back(
                 field_t<Composer>::from_witness_index(ctx, accumulator_witnesses[ColumnIdx::C1][i]));
             lookup[ColumnIdx::C2].emplace_back(
@@ -61,9 +69,46 @@ plookup::ReadData<field_t<Composer>> plookup_<Composer>::get_lookup_accumulators
                 field_t<Composer>::from_witness_index(ctx, accumulator_witnesses[ColumnIdx::C3][i]));
         }
     }
+}
+
+template <typename Composer>
+plookup::ReadData<field_t<Composer>> plookup_<Composer>::get_lookup_accumulators(const MultiTableId id,
+                                                                                 const field_t<Composer>& key_a_in,
+                                                                                 const field_t<Composer>& key_b_in,
+                                                                                 const bool is_2_to_1_lookup)
+{
+    auto key_a = key_a_in.normalize();
+    auto key_b = key_b_in.normalize();
+    const plookup::ReadData<barretenberg::fr> lookup_data =
+        plookup::get_lookup_accumulators(id, key_a.get_value(), key_b.get_value(), is_2_to_1_lookup);
+
+    plookup::ReadData<field_t<Composer>> lookup;
+    create_lookup_witnesses(id, key_a, key_b, is_2_to_1_lookup, lookup_data, lookup);
     return lookup;
 }
 
+template <typename Composer>
+void plookup_<Composer>::get_batch_lookup_accumulators(const MultiTableId id,
+                                                       std::span<const field_t<Composer>> keys_a,
+                                                       std::span<const field_t<Composer>> keys_b,
+                                                       const bool is_2_to_1_lookup,
+                                                       std::vector<plookup::ReadData<field_t<Composer>>>& lookups)
+{
+    ASSERT(keys_b.empty() || keys_b.size() == keys_a.size());
+    const size_t num_keys = keys_a.size();
+    lookups.resize(num_keys);
+
+    // Every key of the batch is queried against the same multi-table, so one set of native columns serves them all.
+    // Each key is normalized, looked up and turned into gates before the next, exactly as in get_lookup_accumulators
+    plookup::ReadData<barretenberg::fr> lookup_data;
+    for (size_t i = 0; i < num_keys; ++i) {
+        const auto key_a = keys_a[i].normalize();
+        const auto key_b = keys_b.empty() ? field_t<Composer>(0) : keys_b[i].normalize();
+        plookup::get_lookup_accumulators(id, key_a.get_value(), key_b.get_value(), is_2_to_1_lookup, lookup_data);
+        create_lookup_witnesses(id, key_a, key_b, is_2_to_1_lookup, lookup_data, lookups[i]);
+    }
+}
+
 template <typename Composer>
 std::pair<field_t<Composer>, field_t<Composer>> plookup_<Composer>::read_pair_from_table(const MultiTableId id,
                                                                                          const field_t<Composer>& key)
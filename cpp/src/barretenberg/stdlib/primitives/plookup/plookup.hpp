@@ -1,5 +1,6 @@
 #pragma once
 #include <array>
+#include <span>
 #include <vector>
 #include "barretenberg/proof_system/plookup_tables/plookup_tables.hpp"
 #include "barretenberg/plonk/composer/ultra_composer.hpp"
@@ -24,6 +25,27 @@ template <typename Composer> class plookup_ {
                                                                const field_pt& key_a,
                                                                const field_pt& key_b = 0,
                                                                const bool is_2_to_1_lookup = false);
+
+    /**
+     * @brief Look up a batch of independent keys in the same multi-table, writing one ReadData per key into `lookups`.
+     *
+     * @details Produces the same gates, in the same order, as calling get_lookup_accumulators on each key in turn.
+     * The entries of `lookups` are refilled in place, so a caller that keeps `lookups` alive across batches (e.g. across
+     * keccak rounds) does not reallocate them. `keys_b` is either empty or the same length as `keys_a`.
+     */
+    static void get_batch_lookup_accumulators(const plookup::MultiTableId id,
+                                              std::span<const field_pt> keys_a,
+                                              std::span<const field_pt> keys_b,
+                                              const bool is_2_to_1_lookup,
+                                              std::vector<plookup::ReadData<field_pt>>& lookups);
+
+  private:
+    static void create_lookup_witnesses(const plookup::MultiTableId id,
+                                        const field_pt& key_a,
+                                        const field_pt& key_b,
+                                        const bool is_2_to_1_lookup,
+                                        const plookup::ReadData<barretenberg::fr>& lookup_data,
+                                        plookup::ReadData<field_pt>& lookup);
 };
 
 extern template class plookup_<plonk::UltraComposer>;
@@ -236,6 +236,64 @@ TEST(stdlib_plookup, uint32_xor)
     EXPECT_EQ(result, true);
 }
 
+TEST(stdlib_plookup, uint32_xor_batch)
+{
+    Composer single_composer = Composer();
+    Composer batch_composer = Composer();
+
+    const size_t num_keys = 6;
+    std::vector<field_ct> single_left(num_keys);
+    std::vector<field_ct> single_right(num_keys);
+    std::vector<field_ct> batch_left(num_keys);
+    std::vector<field_ct> batch_right(num_keys);
+    for (size_t i = 0; i < num_keys; ++i) {
+        const uint256_t left_value = (engine.get_random_uint256() & 0xffffffffULL);
+        const uint256_t right_value = (engine.get_random_uint256() & 0xffffffffULL);
+        // unnormalized keys add a gate each, which must land in the same place as with per-key lookups
+        single_left[i] = field_ct(witness_ct(&single_composer, fr(left_value) - 1)) + 1;
+        batch_left[i] = field_ct(witness_ct(&batch_composer, fr(left_value) - 1)) + 1;
+        // mix in constant keys, which take a different path when creating gates
+        if (i % 3 == 0) {
+            single_right[i] = field_ct(&single_composer, right_value);
+            batch_right[i] = field_ct(&batch_composer, right_value);
+        } else {
+            single_right[i] = witness_ct(&single_composer, right_value);
+            batch_right[i] = witness_ct(&batch_composer, right_value);
+        }
+    }
+
+    std::vector<ReadData<field_ct>> single_lookups;
+    for (size_t i = 0; i < num_keys; ++i) {
+        single_lookups.emplace_back(
+            plookup_read::get_lookup_accumulators(MultiTableId::UINT32_XOR, single_left[i], single_right[i], true));
+    }
+    std::vector<ReadData<field_ct>> batch_lookups;
+    plookup_read::get_batch_lookup_accumulators(MultiTableId::UINT32_XOR, batch_left, batch_right, true, batch_lookups);
+
+    EXPECT_EQ(batch_lookups.size(), num_keys);
+    for (size_t i = 0; i < num_keys; ++i) {
+        for (auto column : { ColumnIdx::C1, ColumnIdx::C2, ColumnIdx::C3 }) {
+            EXPECT_EQ(batch_lookups[i][column].size(), single_lookups[i][column].size());
+            for (size_t j = 0; j < single_lookups[i][column].size(); ++j) {
+                EXPECT_EQ(batch_lookups[i][column][j].get_value(), single_lookups[i][column][j].get_value());
+            }
+        }
+    }
+
+    EXPECT_EQ(batch_composer.get_num_gates(), single_composer.get_num_gates());
+    EXPECT_EQ(batch_composer.get_num_variables(), single_composer.get_num_variables());
+    EXPECT_EQ(batch_composer.w_l, single_composer.w_l);
+    EXPECT_EQ(batch_composer.w_r, single_composer.w_r);
+    EXPECT_EQ(batch_composer.w_o, single_composer.w_o);
+    EXPECT_EQ(batch_composer.w_4, single_composer.w_4);
+
+    auto prover = batch_composer.create_prover();
+    auto verifier = batch_composer.create_verifier();
+    auto proof = prover.construct_proof();
+    bool result = verifier.verify_proof(proof);
+    EXPECT_EQ(result, true);
+}
+
 TEST(stdlib_plookup, blake2s_xor_rotate_16)
 {
     Composer composer = Composer();
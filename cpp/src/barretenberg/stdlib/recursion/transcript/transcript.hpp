@@ -49,7 +49,7 @@ template <typename Composer> class Transcript {
         // }
     }
 
-    transcript::Manifest get_manifest() const { return transcript_base.get_manifest(); }
+    const transcript::Manifest& get_manifest() const { return transcript_base.get_manifest(); }
 
     int check_field_element_cache(const std::string& element_name) const
     {
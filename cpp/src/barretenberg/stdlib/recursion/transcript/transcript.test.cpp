@@ -210,7 +210,7 @@ TEST(stdlib_transcript, validate_transcript)
 
     const auto check_small_element = [&normal_transcript, &recursive_transcript](const std::string& element_name) {
         field_t result = recursive_transcript.get_field_element(element_name);
-        std::vector<uint8_t> expected_raw = normal_transcript.get_element(element_name);
+        const auto expected_raw = normal_transcript.get_element(element_name);
         uint256_t expected_u256(0);
         for (size_t i = 0; i < expected_raw.size(); ++i) {
             expected_u256 *= uint256_t(256);
@@ -1,5 +1,8 @@
 #pragma once
+#include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace transcript {
@@ -67,11 +70,53 @@ class Manifest {
         bool map_challenges;
     };
 
+    /**
+     * The manifest compiled into integer slots. Every distinct element name owns a fixed range of one flat byte arena
+     * and every round owns a fixed range of one flat challenge array, so that a Transcript can store and look up its
+     * data by index rather than by name. It is computed once per Manifest and shared by all of its copies.
+     * */
+    struct Layout {
+        // Lets the name tables be searched with a std::string_view, so that looking up a literal allocates nothing.
+        struct NameHash {
+            using is_transparent = void;
+            size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+        };
+        template <typename T> using NameMap = std::unordered_map<std::string, T, NameHash, std::equal_to<>>;
+
+        struct ElementSlot {
+            size_t offset;
+            size_t num_bytes;
+        };
+
+        struct Entry {
+            size_t element_index;
+            bool derived_by_verifier;
+        };
+
+        // One slot per distinct element name, in order of first appearance in the manifest.
+        std::vector<ElementSlot> element_slots;
+        // The entries of all rounds in manifest order; round i owns [round_entry_offsets[i], round_entry_offsets[i+1]).
+        std::vector<Entry> entries;
+        std::vector<size_t> round_entry_offsets;
+        // Round i generates challenge_names[i], whose values occupy [challenge_offsets[i], challenge_offsets[i+1]).
+        std::vector<std::string> challenge_names;
+        std::vector<size_t> challenge_offsets;
+        size_t num_element_bytes = 0;
+        size_t num_serialized_bytes = 0;
+
+        NameMap<size_t> element_indices;
+        // Maps a challenge name to the round that generates it.
+        NameMap<size_t> challenge_indices;
+        NameMap<int> challenge_map;
+    };
+
     // TODO(luke): needed only in development; can be deleted when appropriate
-    Manifest() = default;
+    Manifest()
+        : layout(compile({})){};
     Manifest(std::vector<RoundManifest> _round_manifests)
         : round_manifests(_round_manifests)
-        , num_rounds(round_manifests.size()){};
+        , num_rounds(round_manifests.size())
+        , layout(compile(round_manifests)){};
 
     size_t get_num_rounds() const { return num_rounds; }
 
@@ -79,8 +124,48 @@ class Manifest {
 
     std::vector<RoundManifest> get_round_manifests() const { return round_manifests; }
 
+    const Layout& get_layout() const { return *layout; }
+
+    // Shared so that a cache keyed on the layout keeps it alive, and cannot be fooled by a new one at the same address
+    const std::shared_ptr<const Layout>& get_shared_layout() const { return layout; }
+
   private:
+    static std::shared_ptr<const Layout> compile(const std::vector<RoundManifest>& rounds)
+    {
+        auto result = std::make_shared<Layout>();
+        result->round_entry_offsets.push_back(0);
+        result->challenge_offsets.push_back(0);
+        for (size_t round = 0; round < rounds.size(); ++round) {
+            for (const auto& element : rounds[round].elements) {
+                // Repeated names share a slot, so the first value added under a name is the one every entry sees.
+                auto [it, inserted] = result->element_indices.try_emplace(element.name, result->element_slots.size());
+                if (inserted) {
+                    result->element_slots.push_back({ result->num_element_bytes, element.num_bytes });
+                    result->num_element_bytes += element.num_bytes;
+                }
+                result->entries.push_back({ it->second, element.derived_by_verifier });
+                if (!element.derived_by_verifier) {
+                    result->num_serialized_bytes += element.num_bytes;
+                }
+                if (rounds[round].map_challenges) {
+                    result->challenge_map.try_emplace(element.name, element.challenge_map_index);
+                }
+            }
+            result->round_entry_offsets.push_back(result->entries.size());
+            result->challenge_names.push_back(rounds[round].challenge);
+            result->challenge_offsets.push_back(result->challenge_offsets.back() + rounds[round].num_challenges);
+
+            // A round without challenges never produces any, so a later round of the same name takes precedence.
+            auto [it, inserted] = result->challenge_indices.try_emplace(rounds[round].challenge, round);
+            if (!inserted && rounds[it->second].num_challenges == 0) {
+                it->second = round;
+            }
+        }
+        return result;
+    }
+
     std::vector<RoundManifest> round_manifests;
-    size_t num_rounds;
+    size_t num_rounds = 0;
+    std::shared_ptr<const Layout> layout;
 }; // namespace transcript
 } // namespace transcript
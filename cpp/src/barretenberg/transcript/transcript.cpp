@@ -80,57 +80,37 @@ Transcript::Transcript(const std::vector<uint8_t>& input_transcript,
     , manifest(input_manifest)
 {
     current_challenge.data = {};
-    const size_t num_rounds = input_manifest.get_num_rounds();
-    const uint8_t* buffer = &input_transcript[0];
-    size_t count = 0;
-    // Compute how much data we need according to the manifest
-    size_t totalRequiredSize = 0;
-    for (size_t i = 0; i < num_rounds; ++i) {
-        for (auto manifest_element : input_manifest.get_round_manifest(i).elements) {
-            if (!manifest_element.derived_by_verifier) {
-                totalRequiredSize += manifest_element.num_bytes;
-            }
-        }
-    }
-    // Check that the total required size is equal to the size of the input_transcript
-    if (totalRequiredSize != input_transcript.size())
+    initialize_storage();
+    const auto& layout = manifest.get_layout();
+    // Check that the total size required by the manifest is equal to the size of the input_transcript
+    if (layout.num_serialized_bytes != input_transcript.size())
         throw_or_abort("Serialized transcript does not contain the required number of bytes");
 
-    for (size_t i = 0; i < num_rounds; ++i) {
-        for (auto manifest_element : input_manifest.get_round_manifest(i).elements) {
-            if (!manifest_element.derived_by_verifier) {
-                // printf("reading element %s ", manifest_element.name.c_str());
-                // for (size_t j = 0; j < manifest_element.num_bytes; ++j) {
-                //     printf("%x", buffer[count + j]);
-                // }
-                // printf("\n");
-
-                // This can once again become a buffer overread if
-                // someone removes the above checks.
-                elements.insert({ manifest_element.name,
-                                  std::vector<uint8_t>(buffer + count, buffer + count + manifest_element.num_bytes) });
-                count += manifest_element.num_bytes;
-            }
+    const uint8_t* buffer = input_transcript.data();
+    size_t count = 0;
+    for (const auto& entry : layout.entries) {
+        if (!entry.derived_by_verifier) {
+            // This can once again become a buffer overread if
+            // someone removes the above checks.
+            const size_t num_bytes = layout.element_slots[entry.element_index].num_bytes;
+            store_element(entry.element_index, buffer + count, num_bytes);
+            count += num_bytes;
         }
     }
-    compute_challenge_map();
-    // printf("input buffer size = %lu \n", count);
 }
 
 /**
- * Insert element names from all rounds of the manifest
- * into the challenge_map.
+ * Size the element arena and the challenge array according to the compiled manifest.
  * */
-void Transcript::compute_challenge_map()
+void Transcript::initialize_storage()
 {
-    challenge_map = std::map<std::string, int>();
-    for (const auto& manifest : manifest.get_round_manifests()) {
-        if (manifest.map_challenges) {
-            for (const auto& element : manifest.elements) {
-                challenge_map.insert({ element.name, element.challenge_map_index });
-            }
-        }
+    const auto& layout = manifest.get_layout();
+    element_records.reserve(layout.element_slots.size());
+    for (const auto& slot : layout.element_slots) {
+        element_records.push_back({ slot.offset, slot.num_bytes, false });
     }
+    element_data.resize(layout.num_element_bytes);
+    challenges.resize(layout.challenge_offsets.back());
 }
 
 /**
@@ -146,9 +126,9 @@ void Transcript::compute_challenge_map()
 void Transcript::mock_inputs_prior_to_challenge(const std::string& challenge_in, size_t circuit_size)
 {
     // Perform operations only up to fiat-shamir of challenge_in
-    for (auto& manifest : manifest.get_round_manifests()) // loop over RoundManifests
+    for (const auto& manifest : manifest.get_round_manifests()) // loop over RoundManifests
     {
-        for (auto& entry : manifest.elements) // loop over ManifestEntrys
+        for (const auto& entry : manifest.elements) // loop over ManifestEntrys
         {
             if (entry.name == "circuit_size") {
                 add_element("circuit_size",
@@ -172,7 +152,40 @@ void Transcript::mock_inputs_prior_to_challenge(const std::string& challenge_in,
 void Transcript::add_element(const std::string& element_name, const std::vector<uint8_t>& buffer)
 {
     info_togglable("add_element(): ", element_name, "\n");
-    elements.insert({ element_name, buffer });
+    size_t element_index = find_element_index(element_name);
+    if (element_index == NOT_FOUND) {
+        // The element is not described by the manifest: give it a record of its own.
+        element_index = element_records.size();
+        element_records.push_back({ element_data.size(), 0, false });
+        unlisted_elements.insert({ element_name, element_index });
+    }
+    store_element(element_index, buffer.data(), buffer.size());
+}
+
+void Transcript::add_element(const size_t element_index, const std::vector<uint8_t>& buffer)
+{
+    store_element(element_index, buffer.data(), buffer.size());
+}
+
+/**
+ * Copy an element into its slot of the arena. An element of a different size than the manifest expects (which is only
+ * legal for elements derived by the verifier) is appended to the arena instead.
+ * As with names, the first value added for an element is kept.
+ * */
+void Transcript::store_element(const size_t element_index, const uint8_t* data, const size_t num_bytes)
+{
+    ASSERT(element_index < element_records.size());
+    element_record& record = element_records[element_index];
+    if (record.present) {
+        return;
+    }
+    if (num_bytes != record.num_bytes) {
+        record.offset = element_data.size();
+        record.num_bytes = num_bytes;
+        element_data.resize(element_data.size() + num_bytes);
+    }
+    std::copy(data, data + num_bytes, element_data.begin() + static_cast<std::ptrdiff_t>(record.offset));
+    record.present = true;
 }
 
 /**
@@ -185,16 +198,17 @@ void Transcript::apply_fiat_shamir(const std::string& challenge_name /*, const b
 {
     // For reference, see the relevant manifest, which is defined in
     // plonk/composer/[standard/turbo/ultra]_composer.hpp
+    const auto& layout = manifest.get_layout();
     ASSERT(current_round <= manifest.get_num_rounds());
     // TODO(Cody): Coupling: this line insists that the challenges in the manifest
     // are encountered in the order that matches the order of the proof construction functions.
     // Future architecture should specify this data in a single place (?).
     info_togglable("apply_fiat_shamir(): challenge name match:");
     info_togglable("\t challenge_name in: ", challenge_name);
-    info_togglable("\t challenge_name expected: ", manifest.get_round_manifest(current_round).challenge, "\n");
-    ASSERT(challenge_name == manifest.get_round_manifest(current_round).challenge);
+    info_togglable("\t challenge_name expected: ", layout.challenge_names[current_round], "\n");
+    ASSERT(challenge_name == layout.challenge_names[current_round]);
 
-    const size_t num_challenges = manifest.get_round_manifest(current_round).num_challenges;
+    const size_t num_challenges = get_num_challenges(current_round);
     if (num_challenges == 0) {
         ++current_round;
         return;
@@ -203,25 +217,32 @@ void Transcript::apply_fiat_shamir(const std::string& challenge_name /*, const b
     // Combine the very last challenge from the previous fiat-shamir round (which is, inductively, a hash containing the
     // manifest data of all previous rounds), plus the manifest data for this round, into a buffer. This buffer will
     // ultimately be hashed, to form this round's fiat-shamir challenge(s).
+    const size_t first_entry = layout.round_entry_offsets[current_round];
+    const size_t last_entry = layout.round_entry_offsets[current_round + 1];
+    size_t buffer_size = PRNG_OUTPUT_SIZE;
+    for (size_t i = first_entry; i < last_entry; ++i) {
+        buffer_size += element_records[layout.entries[i].element_index].num_bytes;
+    }
     std::vector<uint8_t> buffer;
+    buffer.reserve(buffer_size);
     if (current_round > 0) {
         buffer.insert(buffer.end(), current_challenge.data.begin(), current_challenge.data.end());
     }
-    for (auto manifest_element : manifest.get_round_manifest(current_round).elements) {
-        info_togglable("apply_fiat_shamir(): manifest element name match:");
-        info_togglable("\t element name: ", manifest_element.name);
-        info_togglable(
-            "\t element exists and is unique: ", (elements.count(manifest_element.name) == 1) ? "true" : "false", "\n");
-        ASSERT(elements.count(manifest_element.name) == 1);
-
-        std::vector<uint8_t>& element_data = elements.at(manifest_element.name);
-        if (!manifest_element.derived_by_verifier) {
-            ASSERT(manifest_element.num_bytes == element_data.size());
+    for (size_t i = first_entry; i < last_entry; ++i) {
+        const auto& entry = layout.entries[i];
+        const element_record& record = element_records[entry.element_index];
+        info_togglable("apply_fiat_shamir(): manifest element exists: ", record.present ? "true" : "false", "\n");
+        ASSERT(record.present);
+
+        if (!entry.derived_by_verifier) {
+            ASSERT(layout.element_slots[entry.element_index].num_bytes == record.num_bytes);
         }
-        buffer.insert(buffer.end(), element_data.begin(), element_data.end());
+        const auto element_begin = element_data.begin() + static_cast<std::ptrdiff_t>(record.offset);
+        buffer.insert(buffer.end(), element_begin, element_begin + static_cast<std::ptrdiff_t>(record.num_bytes));
     }
 
-    std::vector<challenge> round_challenges;
+    challenge* round_challenges = &challenges[layout.challenge_offsets[current_round]];
+    size_t num_round_challenges = 0;
     std::array<uint8_t, PRNG_OUTPUT_SIZE> base_hash{};
 
     switch (hasher) {
@@ -258,7 +279,7 @@ void Transcript::apply_fiat_shamir(const std::string& challenge_name /*, const b
                           (PRNG_OUTPUT_SIZE -
                            num_challenge_bytes)); // Left-pad the challenge with zeros, and then copy the next
                                                   // num_challange_bytes slice of the hash to the rhs of the challenge.
-            round_challenges.push_back({ challenge });
+            round_challenges[num_round_challenges++] = { challenge };
         }
     }
 
@@ -304,16 +325,16 @@ void Transcript::apply_fiat_shamir(const std::string& challenge_name /*, const b
                 std::copy(hash_output.begin() + (j * num_challenge_bytes),
                           hash_output.begin() + (j + 1) * num_challenge_bytes,
                           challenge.begin() + (PRNG_OUTPUT_SIZE - num_challenge_bytes));
-                round_challenges.push_back({ challenge });
+                round_challenges[num_round_challenges++] = { challenge };
             }
         }
     }
 
     // Remember the very last challenge, as it will be included in the buffer of the next fiat-shamir round (since this
     // challenge is effectively a hash of _all_ previous rounds' manifest data).
-    current_challenge = round_challenges[round_challenges.size() - 1];
+    ASSERT(num_round_challenges == num_challenges);
+    current_challenge = round_challenges[num_challenges - 1];
 
-    challenges.insert({ challenge_name, round_challenges });
     ++current_round;
 }
 
@@ -327,12 +348,27 @@ void Transcript::apply_fiat_shamir(const std::string& challenge_name /*, const b
  *
  * @return The challenge value
  * */
-std::array<uint8_t, Transcript::PRNG_OUTPUT_SIZE> Transcript::get_challenge(const std::string& challenge_name,
+std::array<uint8_t, Transcript::PRNG_OUTPUT_SIZE> Transcript::get_challenge(std::string_view challenge_name,
                                                                             const size_t idx) const
 {
     info_togglable("get_challenge(): ", challenge_name, "\n");
-    ASSERT(challenges.count(challenge_name) == 1);
-    return challenges.at(challenge_name)[idx].data;
+    return get_challenge(get_challenge_index(challenge_name), idx);
+}
+
+/**
+ * Get the challenge at index of the round with the given challenge index.
+ *
+ * @param challenge_index   The index of the challenge, see get_challenge_index().
+ * @param idx               The idx of subchallenge
+ *
+ * @return The challenge value
+ * */
+std::array<uint8_t, Transcript::PRNG_OUTPUT_SIZE> Transcript::get_challenge(const size_t challenge_index,
+                                                                            const size_t idx) const
+{
+    ASSERT(has_challenge(challenge_index));
+    ASSERT(idx < get_num_challenges(challenge_index));
+    return challenges[manifest.get_layout().challenge_offsets[challenge_index] + idx].data;
 }
 
 /**
@@ -343,10 +379,14 @@ std::array<uint8_t, Transcript::PRNG_OUTPUT_SIZE> Transcript::get_challenge(cons
  * @return The index of the subchallenge in the vector
  *  corresponding to the challenge.
  * */
-int Transcript::get_challenge_index_from_map(const std::string& challenge_map_name) const
+int Transcript::get_challenge_index_from_map(std::string_view challenge_map_name) const
 {
-    const auto key = challenge_map.at(challenge_map_name);
-    return key;
+    const auto& challenge_map = manifest.get_layout().challenge_map;
+    const auto it = challenge_map.find(challenge_map_name);
+    if (it == challenge_map.end()) {
+        throw_or_abort("Transcript: no challenge map entry named " + std::string(challenge_map_name));
+    }
+    return it->second;
 }
 
 /**
@@ -356,9 +396,23 @@ int Transcript::get_challenge_index_from_map(const std::string& challenge_map_na
  *
  * @return true if exists, false if not
  * **/
-bool Transcript::has_challenge(const std::string& challenge_name) const
+bool Transcript::has_challenge(std::string_view challenge_name) const
+{
+    const auto& challenge_indices = manifest.get_layout().challenge_indices;
+    const auto it = challenge_indices.find(challenge_name);
+    return it != challenge_indices.end() && has_challenge(it->second);
+}
+
+/**
+ * Check if the challenges of a round have been generated.
+ *
+ * @param challenge_index The index of the challenge, see get_challenge_index().
+ *
+ * @return true if exists, false if not
+ * **/
+bool Transcript::has_challenge(const size_t challenge_index) const
 {
-    return (challenges.count(challenge_name) > 0);
+    return challenge_index < current_round && get_num_challenges(challenge_index) > 0;
 }
 
 /**
@@ -371,10 +425,24 @@ bool Transcript::has_challenge(const std::string& challenge_name) const
  * @return The value of the subchallenge.
  * */
 std::array<uint8_t, Transcript::PRNG_OUTPUT_SIZE> Transcript::get_challenge_from_map(
-    const std::string& challenge_name, const std::string& challenge_map_name) const
+    std::string_view challenge_name, std::string_view challenge_map_name) const
+{
+    return get_challenge_from_map(get_challenge_index(challenge_name),
+                                  get_challenge_index_from_map(challenge_map_name));
+}
+
+/**
+ * Get a particular subchallenge value by index.
+ *
+ * @param challenge_index The index of the challenge, see get_challenge_index().
+ * @param challenge_map_index The index of the subchallenge, see get_challenge_index_from_map().
+ *
+ * @return The value of the subchallenge, or one if challenge_map_index is -1.
+ * */
+std::array<uint8_t, Transcript::PRNG_OUTPUT_SIZE> Transcript::get_challenge_from_map(
+    const size_t challenge_index, const int challenge_map_index) const
 {
-    const auto key = challenge_map.at(challenge_map_name);
-    if (key == -1) {
+    if (challenge_map_index == -1) {
         std::array<uint8_t, Transcript::PRNG_OUTPUT_SIZE> result;
         for (size_t i = 0; i < Transcript::PRNG_OUTPUT_SIZE - 1; ++i) {
             result[i] = 0;
@@ -382,8 +450,7 @@ std::array<uint8_t, Transcript::PRNG_OUTPUT_SIZE> Transcript::get_challenge_from
         result[Transcript::PRNG_OUTPUT_SIZE - 1] = 1;
         return result;
     }
-    const auto value = challenges.at(challenge_name)[static_cast<size_t>(key)];
-    return value.data;
+    return get_challenge(challenge_index, static_cast<size_t>(challenge_map_index));
 }
 
 /**
@@ -396,25 +463,99 @@ std::array<uint8_t, Transcript::PRNG_OUTPUT_SIZE> Transcript::get_challenge_from
  *
  * @return The number of subchallenges.
  * */
-size_t Transcript::get_num_challenges(const std::string& challenge_name) const
+size_t Transcript::get_num_challenges(std::string_view challenge_name) const
 {
-    ASSERT(challenges.count(challenge_name) == 1);
+    const size_t challenge_index = get_challenge_index(challenge_name);
+    ASSERT(has_challenge(challenge_index));
+    return get_num_challenges(challenge_index);
+}
 
-    return challenges.at(challenge_name).size();
+/**
+ * Get the number of subchallenges generated in the round with the given challenge index.
+ * */
+size_t Transcript::get_num_challenges(const size_t challenge_index) const
+{
+    const auto& challenge_offsets = manifest.get_layout().challenge_offsets;
+    ASSERT(challenge_index + 1 < challenge_offsets.size());
+    return challenge_offsets[challenge_index + 1] - challenge_offsets[challenge_index];
 }
 
 /**
- * Get the value of an element.
+ * Get the index under which the challenge(s) with the given name are stored.
+ * Fails if the manifest has no such challenge.
+ *
+ * @param challenge_name The name of the challenge.
+ *
+ * @return The challenge index, which is the same for every transcript using this manifest.
+ * */
+size_t Transcript::get_challenge_index(std::string_view challenge_name) const
+{
+    const auto& challenge_indices = manifest.get_layout().challenge_indices;
+    const auto it = challenge_indices.find(challenge_name);
+    if (it == challenge_indices.end()) {
+        throw_or_abort("Transcript: no challenge named " + std::string(challenge_name));
+    }
+    return it->second;
+}
+
+/**
+ * Get a view of the value of an element, without copying it.
  * Fails if there is no such element.
  *
  * @param element_name The name of the element.
  *
- * @return The value of the element.
+ * @return The bytes of the element.
  * */
-std::vector<uint8_t> Transcript::get_element(const std::string& element_name) const
+std::span<const uint8_t> Transcript::get_element(std::string_view element_name) const
 {
-    ASSERT(elements.count(element_name) == 1);
-    return elements.at(element_name);
+    return get_element_bytes(get_element_index(element_name));
+}
+
+/**
+ * Get a view of the value of an element, without copying it.
+ * Fails if the element has not been added.
+ *
+ * @param element_index The index of the element, see get_element_index().
+ *
+ * @return The bytes of the element.
+ * */
+std::span<const uint8_t> Transcript::get_element_bytes(const size_t element_index) const
+{
+    ASSERT(element_index < element_records.size());
+    const element_record& record = element_records[element_index];
+    if (!record.present) {
+        throw_or_abort("Transcript: element has not been added");
+    }
+    return { element_data.data() + record.offset, record.num_bytes };
+}
+
+/**
+ * Get the index under which an element is stored.
+ * Fails if there is no such element.
+ *
+ * @param element_name The name of the element.
+ *
+ * @return The element index. For elements in the manifest it is the same for every transcript using this manifest.
+ * */
+size_t Transcript::get_element_index(std::string_view element_name) const
+{
+    const size_t element_index = find_element_index(element_name);
+    if (element_index == NOT_FOUND) {
+        throw_or_abort("Transcript: no element named " + std::string(element_name));
+    }
+    return element_index;
+}
+
+size_t Transcript::find_element_index(std::string_view element_name) const
+{
+    const auto& element_indices = manifest.get_layout().element_indices;
+    if (const auto it = element_indices.find(element_name); it != element_indices.end()) {
+        return it->second;
+    }
+    if (const auto it = unlisted_elements.find(element_name); it != unlisted_elements.end()) {
+        return it->second;
+    }
+    return NOT_FOUND;
 }
 
 /**
@@ -424,16 +565,14 @@ std::vector<uint8_t> Transcript::get_element(const std::string& element_name) co
  *
  * @return The size of the element if found, otherwise -1.
  * */
-size_t Transcript::get_element_size(const std::string& element_name) const
+size_t Transcript::get_element_size(std::string_view element_name) const
 {
-    for (size_t i = 0; i < manifest.get_num_rounds(); ++i) {
-        for (auto manifest_element : manifest.get_round_manifest(i).elements) {
-            if (manifest_element.name == element_name) {
-                return manifest_element.num_bytes;
-            }
-        }
+    const auto& layout = manifest.get_layout();
+    const auto it = layout.element_indices.find(element_name);
+    if (it == layout.element_indices.end()) {
+        return static_cast<size_t>(-1);
     }
-    return static_cast<size_t>(-1);
+    return layout.element_slots[it->second].num_bytes;
 }
 
 /**
@@ -443,26 +582,19 @@ size_t Transcript::get_element_size(const std::string& element_name) const
  * */
 std::vector<uint8_t> Transcript::export_transcript() const
 {
+    const auto& layout = manifest.get_layout();
     std::vector<uint8_t> buffer;
-
-    for (size_t i = 0; i < manifest.get_num_rounds(); ++i) {
-        for (auto manifest_element : manifest.get_round_manifest(i).elements) {
-            ASSERT(elements.count(manifest_element.name) == 1);
-            const std::vector<uint8_t>& element_data = elements.at(manifest_element.name);
-            if (!manifest_element.derived_by_verifier) {
-                ASSERT(manifest_element.num_bytes == element_data.size());
-            }
-            if (!manifest_element.derived_by_verifier) {
-                // printf("writing element %s ", manifest_element.name.c_str());
-                // for (size_t j = 0; j < element_data.size(); ++j) {
-                //     printf("%x", element_data[j]);
-                // }
-                // printf("\n");
-                buffer.insert(buffer.end(), element_data.begin(), element_data.end());
-            }
+    buffer.reserve(layout.num_serialized_bytes);
+
+    for (const auto& entry : layout.entries) {
+        const element_record& record = element_records[entry.element_index];
+        ASSERT(record.present);
+        if (!entry.derived_by_verifier) {
+            ASSERT(layout.element_slots[entry.element_index].num_bytes == record.num_bytes);
+            const auto element_begin = element_data.begin() + static_cast<std::ptrdiff_t>(record.offset);
+            buffer.insert(buffer.end(), element_begin, element_begin + static_cast<std::ptrdiff_t>(record.num_bytes));
         }
     }
-    // printf("output buffer size = %lu \n", buffer.size());
     return buffer;
 }
 
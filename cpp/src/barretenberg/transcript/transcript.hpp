@@ -2,7 +2,9 @@
 #include "manifest.hpp"
 #include <array>
 #include <map>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <exception>
 
@@ -32,12 +34,21 @@ enum HashType { Keccak256, PedersenBlake3s, PlookupPedersenBlake3s };
  * and derive challenges. The verifier uses it to parse serialized
  * values and get the data and challenges back.
  *
+ * Elements and challenges live in flat buffers laid out by the compiled manifest (see Manifest::Layout). They can be
+ * addressed by index, via get_element_index() and get_challenge_index(), or by name, which costs one hash lookup.
+ *
  */
 class Transcript {
     static constexpr size_t PRNG_OUTPUT_SIZE = 32;
     struct challenge {
         std::array<uint8_t, PRNG_OUTPUT_SIZE> data;
     };
+    struct element_record {
+        size_t offset;
+        size_t num_bytes;
+        bool present;
+    };
+    static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
 
   public:
     typedef proof_system::plonk::verification_key Key;
@@ -59,7 +70,7 @@ class Transcript {
     {
         // Just to be safe, because compilers can be weird.
         current_challenge.data = {};
-        compute_challenge_map();
+        initialize_storage();
     }
 
     /**
@@ -77,48 +88,76 @@ class Transcript {
                const HashType hash_type = HashType::Keccak256,
                const size_t challenge_bytes = 32);
 
-    Manifest get_manifest() const { return manifest; }
+    const Manifest& get_manifest() const { return manifest; }
 
     void add_element(const std::string& element_name, const std::vector<uint8_t>& buffer);
 
     void apply_fiat_shamir(const std::string& challenge_name /*, const bool debug = false*/);
 
-    bool has_challenge(const std::string& challenge_name) const;
+    bool has_challenge(std::string_view challenge_name) const;
 
-    std::array<uint8_t, PRNG_OUTPUT_SIZE> get_challenge(const std::string& challenge_name, const size_t idx = 0) const;
+    std::array<uint8_t, PRNG_OUTPUT_SIZE> get_challenge(std::string_view challenge_name, const size_t idx = 0) const;
 
-    int get_challenge_index_from_map(const std::string& challenge_map_name) const;
+    int get_challenge_index_from_map(std::string_view challenge_map_name) const;
 
-    std::array<uint8_t, PRNG_OUTPUT_SIZE> get_challenge_from_map(const std::string& challenge_name,
-                                                                 const std::string& challenge_map_name) const;
+    std::array<uint8_t, PRNG_OUTPUT_SIZE> get_challenge_from_map(std::string_view challenge_name,
+                                                                 std::string_view challenge_map_name) const;
 
-    size_t get_num_challenges(const std::string& challenge_name) const;
+    size_t get_num_challenges(std::string_view challenge_name) const;
 
-    std::vector<uint8_t> get_element(const std::string& element_name) const;
+    // The returned view is invalidated by the next call to add_element().
+    std::span<const uint8_t> get_element(std::string_view element_name) const;
 
-    size_t get_element_size(const std::string& element_name) const;
+    size_t get_element_size(std::string_view element_name) const;
 
-    std::vector<uint8_t> export_transcript() const;
+    // Index-based access. Indices come from the manifest and are therefore stable across proofs using it.
+    size_t get_element_index(std::string_view element_name) const;
+
+    size_t get_challenge_index(std::string_view challenge_name) const;
+
+    void add_element(const size_t element_index, const std::vector<uint8_t>& buffer);
+
+    // The returned view is invalidated by the next call to add_element().
+    std::span<const uint8_t> get_element_bytes(const size_t element_index) const;
+
+    bool has_challenge(const size_t challenge_index) const;
+
+    std::array<uint8_t, PRNG_OUTPUT_SIZE> get_challenge(const size_t challenge_index, const size_t idx = 0) const;
 
-    void compute_challenge_map();
+    // challenge_map_index is as returned by get_challenge_index_from_map().
+    std::array<uint8_t, PRNG_OUTPUT_SIZE> get_challenge_from_map(const size_t challenge_index,
+                                                                 const int challenge_map_index) const;
+
+    size_t get_num_challenges(const size_t challenge_index) const;
+
+    std::vector<uint8_t> export_transcript() const;
 
     void mock_inputs_prior_to_challenge(const std::string& challenge_name, size_t circuit_size = 1);
 
     void print();
 
   private:
+    void initialize_storage();
+
+    size_t find_element_index(std::string_view element_name) const;
+
+    void store_element(const size_t element_index, const uint8_t* data, const size_t num_bytes);
+
     // The round of the protocol
     size_t current_round = 0;
     size_t num_challenge_bytes;
     HashType hasher;
-    std::map<std::string, std::vector<uint8_t>> elements;
 
-    std::map<std::string, std::vector<challenge>> challenges;
+    // One record per manifest element slot, followed by any elements the manifest does not describe.
+    std::vector<element_record> element_records;
+    std::vector<uint8_t> element_data;
+    std::map<std::string, size_t, std::less<>> unlisted_elements;
+
+    std::vector<challenge> challenges;
 
     challenge current_challenge;
 
     Manifest manifest;
-    std::map<std::string, int> challenge_map;
 };
 
 } // namespace transcript
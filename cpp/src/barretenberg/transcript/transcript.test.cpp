@@ -96,7 +96,7 @@ TEST(transcript, validate_transcript)
 
     transcript.apply_fiat_shamir("separator");
 
-    std::vector<uint8_t> result = transcript.get_element("PI_Z_OMEGA");
+    const auto result = transcript.get_element("PI_Z_OMEGA");
     EXPECT_EQ(result.size(), g1_vector.size());
     for (size_t i = 0; i < result.size(); ++i) {
         EXPECT_EQ(result[i], g1_vector[i]);
@@ -188,4 +188,73 @@ TEST(transcript, univariate_serialization)
     for (size_t i = 0; i < LENGTH; ++i) {
         EXPECT_EQ(univariate.value_at(i), deserialized_univariate.value_at(i));
     }
-}
\ No newline at end of file
+}
+TEST(transcript, index_access_matches_name_access)
+{
+    using Transcript = transcript::StandardTranscript;
+    using Fr = barretenberg::fr;
+
+    const auto manifest = create_manifest(1);
+    auto prover_transcript = Transcript(manifest);
+    const size_t public_inputs_index = prover_transcript.get_element_index("public_inputs");
+    const size_t beta_index = prover_transcript.get_challenge_index("beta");
+    EXPECT_EQ(prover_transcript.get_element_index("public_inputs"), public_inputs_index);
+
+    prover_transcript.add_element("circuit_size", { 1, 2, 3, 4 });
+    prover_transcript.add_element("public_input_size", { 0, 0, 0, 1 });
+    prover_transcript.apply_fiat_shamir("init");
+    EXPECT_FALSE(prover_transcript.has_challenge(beta_index));
+
+    const Fr public_input = Fr::random_element();
+    prover_transcript.add_field_element(public_inputs_index, public_input);
+    for (const auto& name : { "W_1", "W_2", "W_3" }) {
+        prover_transcript.add_element(name, barretenberg::g1::affine_element(barretenberg::g1::one).to_buffer());
+    }
+    prover_transcript.apply_fiat_shamir("beta");
+
+    EXPECT_EQ(prover_transcript.get_field_element("public_inputs"), public_input);
+    EXPECT_EQ(prover_transcript.get_field_element(public_inputs_index), public_input);
+    EXPECT_EQ(prover_transcript.get_group_element("W_2"), barretenberg::g1::affine_element(barretenberg::g1::one));
+    EXPECT_TRUE(prover_transcript.has_challenge(beta_index));
+    EXPECT_EQ(prover_transcript.get_num_challenges(beta_index), 2UL);
+    EXPECT_EQ(prover_transcript.get_challenge_field_element(beta_index, 1),
+              prover_transcript.get_challenge_field_element("beta", 1));
+    EXPECT_NE(prover_transcript.get_challenge_field_element("beta", 0),
+              prover_transcript.get_challenge_field_element("beta", 1));
+
+    // Adding an element a second time keeps the first value.
+    prover_transcript.add_field_element("public_inputs", Fr::random_element());
+    EXPECT_EQ(prover_transcript.get_field_element(public_inputs_index), public_input);
+
+    // Complete the prover transcript, then check that a verifier reading its serialization derives the same
+    // challenges.
+    prover_transcript.add_element("Z_PERM", std::vector<uint8_t>(64, 1));
+    prover_transcript.apply_fiat_shamir("alpha");
+    for (const auto& name : { "T_1", "T_2", "T_3" }) {
+        prover_transcript.add_element(name, std::vector<uint8_t>(64, 2));
+    }
+    prover_transcript.apply_fiat_shamir("z");
+    for (const auto& name : { "w_1", "w_2", "w_3", "w_3_omega", "z_perm_omega", "sigma_1", "sigma_2", "r", "t" }) {
+        prover_transcript.add_field_element(name, Fr::random_element());
+    }
+    prover_transcript.apply_fiat_shamir("nu");
+    prover_transcript.add_element("PI_Z", std::vector<uint8_t>(64, 3));
+    prover_transcript.add_element("PI_Z_OMEGA", std::vector<uint8_t>(64, 4));
+    prover_transcript.apply_fiat_shamir("separator");
+
+    const std::vector<uint8_t> proof = prover_transcript.export_transcript();
+    EXPECT_EQ(proof.size(), 32 + 9 * 64 + 8 * 32UL);
+
+    auto verifier_transcript = Transcript(proof, manifest);
+    EXPECT_EQ(verifier_transcript.get_field_element(public_inputs_index), public_input);
+    verifier_transcript.add_element("circuit_size", { 1, 2, 3, 4 });
+    verifier_transcript.add_element("public_input_size", { 0, 0, 0, 1 });
+    verifier_transcript.add_field_element("t", prover_transcript.get_field_element("t"));
+    for (const auto& challenge : { "init", "beta", "alpha", "z", "nu", "separator" }) {
+        verifier_transcript.apply_fiat_shamir(challenge);
+    }
+    for (const auto& challenge : { "beta", "alpha", "z", "separator" }) {
+        EXPECT_EQ(verifier_transcript.get_challenge(challenge), prover_transcript.get_challenge(challenge));
+    }
+    EXPECT_EQ(verifier_transcript.get_challenge("nu", 9), prover_transcript.get_challenge("nu", 9));
+}
@@ -8,30 +8,56 @@ void StandardTranscript::add_field_element(const std::string& element_name, cons
     add_element(element_name, element.to_buffer());
 }
 
-barretenberg::fr StandardTranscript::get_field_element(const std::string& element_name) const
+barretenberg::fr StandardTranscript::get_field_element(std::string_view element_name) const
 {
-    return barretenberg::fr::serialize_from_buffer(&(get_element(element_name))[0]);
+    return get_field_element(get_element_index(element_name));
 }
 
-barretenberg::g1::affine_element StandardTranscript::get_group_element(const std::string& element_name) const
+barretenberg::g1::affine_element StandardTranscript::get_group_element(std::string_view element_name) const
 {
-    return barretenberg::g1::affine_element::serialize_from_buffer(&(get_element(element_name))[0]);
+    return get_group_element(get_element_index(element_name));
 }
 
-std::vector<barretenberg::fr> StandardTranscript::get_field_element_vector(const std::string& element_name) const
+std::vector<barretenberg::fr> StandardTranscript::get_field_element_vector(std::string_view element_name) const
 {
     return many_from_buffer<barretenberg::fr>(get_element(element_name));
 }
 
-barretenberg::fr StandardTranscript::get_challenge_field_element(const std::string& challenge_name,
+barretenberg::fr StandardTranscript::get_challenge_field_element(std::string_view challenge_name,
                                                                  const size_t idx) const
 {
-    return barretenberg::fr::serialize_from_buffer(&(get_challenge(challenge_name, idx))[0]);
+    return get_challenge_field_element(get_challenge_index(challenge_name), idx);
 }
 
-barretenberg::fr StandardTranscript::get_challenge_field_element_from_map(const std::string& challenge_name,
-                                                                          const std::string& challenge_map_name) const
+barretenberg::fr StandardTranscript::get_challenge_field_element_from_map(std::string_view challenge_name,
+                                                                          std::string_view challenge_map_name) const
 {
     return barretenberg::fr::serialize_from_buffer(&(get_challenge_from_map(challenge_name, challenge_map_name))[0]);
 }
+
+void StandardTranscript::add_field_element(const size_t element_index, const barretenberg::fr& element)
+{
+    add_element(element_index, element.to_buffer());
+}
+
+barretenberg::fr StandardTranscript::get_field_element(const size_t element_index) const
+{
+    return barretenberg::fr::serialize_from_buffer(get_element_bytes(element_index).data());
+}
+
+barretenberg::g1::affine_element StandardTranscript::get_group_element(const size_t element_index) const
+{
+    return barretenberg::g1::affine_element::serialize_from_buffer(get_element_bytes(element_index).data());
+}
+
+barretenberg::fr StandardTranscript::get_challenge_field_element(const size_t challenge_index, const size_t idx) const
+{
+    return barretenberg::fr::serialize_from_buffer(&(get_challenge(challenge_index, idx))[0]);
+}
+
+barretenberg::fr StandardTranscript::get_challenge_field_element_from_map(const size_t challenge_index,
+                                                                          const int challenge_map_index) const
+{
+    return barretenberg::fr::serialize_from_buffer(&(get_challenge_from_map(challenge_index, challenge_map_index))[0]);
+}
 } // namespace transcript
@@ -3,6 +3,7 @@
 #include "./transcript.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
+#include <string_view>
 #include <unordered_map>
 
 namespace transcript {
@@ -43,14 +44,24 @@ class StandardTranscript : public Transcript {
 
     void add_field_element(const std::string& element_name, const barretenberg::fr& element);
 
-    barretenberg::fr get_field_element(const std::string& element_name) const;
-    barretenberg::g1::affine_element get_group_element(const std::string& element_name) const;
+    barretenberg::fr get_field_element(std::string_view element_name) const;
+    barretenberg::g1::affine_element get_group_element(std::string_view element_name) const;
 
-    std::vector<barretenberg::fr> get_field_element_vector(const std::string& element_name) const;
+    std::vector<barretenberg::fr> get_field_element_vector(std::string_view element_name) const;
 
-    barretenberg::fr get_challenge_field_element(const std::string& challenge_name, const size_t idx = 0) const;
-    barretenberg::fr get_challenge_field_element_from_map(const std::string& challenge_name,
-                                                          const std::string& challenge_map_name) const;
+    barretenberg::fr get_challenge_field_element(std::string_view challenge_name, const size_t idx = 0) const;
+    barretenberg::fr get_challenge_field_element_from_map(std::string_view challenge_name,
+                                                          std::string_view challenge_map_name) const;
+
+    // Index-based variants of the above; see Transcript::get_element_index() and get_challenge_index().
+    void add_field_element(const size_t element_index, const barretenberg::fr& element);
+
+    barretenberg::fr get_field_element(const size_t element_index) const;
+    barretenberg::g1::affine_element get_group_element(const size_t element_index) const;
+
+    barretenberg::fr get_challenge_field_element(const size_t challenge_index, const size_t idx = 0) const;
+    barretenberg::fr get_challenge_field_element_from_map(const size_t challenge_index,
+                                                          const int challenge_map_index) const;
 
     std::vector<uint8_t> export_transcript() const { return Transcript::export_transcript(); }
 